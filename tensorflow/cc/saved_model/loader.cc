@@ -27,6 +27,8 @@ limitations under the License.
 #include "tensorflow/core/framework/node_def.pb.h"
 #include "tensorflow/core/framework/op_def.pb.h"
 #include "tensorflow/core/framework/tensor.pb.h"
+#include "tensorflow/core/graph/tensor_id.h"
+#include "tensorflow/core/grappler/utils/transitive_fanin.h"
 #include "tensorflow/core/lib/io/path.h"
 #include "tensorflow/core/lib/monitoring/counter.h"
 #include "tensorflow/core/lib/monitoring/sampler.h"
@@ -287,6 +289,67 @@ Status LoadSavedModelInternal(const SessionOptions& session_options,
   return Status::OK();
 }
 
+Status PruneMetaGraphForSignatures(
+    const string& export_dir, const std::unordered_set<string>& signatures,
+    MetaGraphDef* meta_graph_def) {
+  // Terminal nodes: every kept signature's outputs and inputs (feeds must
+  // survive pruning even when dead from the fetches' perspective, since the
+  // session validates fed names), plus the init op if present.
+  std::vector<string> terminal_nodes;
+  auto& signature_map = *meta_graph_def->mutable_signature_def();
+  for (const string& signature : signatures) {
+    auto it = signature_map.find(signature);
+    if (it == signature_map.end()) {
+      return errors::InvalidArgument("Signature not found in SavedModel: ",
+                                     signature);
+    }
+    for (const auto& name_and_info : it->second.outputs()) {
+      terminal_nodes.push_back(
+          string(ParseTensorName(name_and_info.second.name()).first));
+    }
+    for (const auto& name_and_info : it->second.inputs()) {
+      terminal_nodes.push_back(
+          string(ParseTensorName(name_and_info.second.name()).first));
+    }
+  }
+  string init_op_name;
+  TF_RETURN_IF_ERROR(
+      internal::GetInitOp(export_dir, *meta_graph_def, &init_op_name));
+  if (!init_op_name.empty()) {
+    terminal_nodes.push_back(string(ParseTensorName(init_op_name).first));
+  }
+  // Keep the saver's restore subgraph (its fanin includes the filename
+  // placeholder), so the pruned metagraph still works with RestoreSession.
+  // The save subgraph is deliberately dropped: serving replicas restore but
+  // never save.
+  if (meta_graph_def->has_saver_def() &&
+      !meta_graph_def->saver_def().restore_op_name().empty()) {
+    terminal_nodes.push_back(string(
+        ParseTensorName(meta_graph_def->saver_def().restore_op_name()).first));
+  }
+
+  GraphDef pruned_graph;
+  TF_RETURN_IF_ERROR(grappler::SetTransitiveFaninGraph(
+      meta_graph_def->graph_def(), &pruned_graph, terminal_nodes));
+  const int before = meta_graph_def->graph_def().node_size();
+  *pruned_graph.mutable_library() = meta_graph_def->graph_def().library();
+  *pruned_graph.mutable_versions() = meta_graph_def->graph_def().versions();
+  *meta_graph_def->mutable_graph_def() = std::move(pruned_graph);
+  LOG(INFO) << "Pruned SavedModel graph from " << before << " to "
+            << meta_graph_def->graph_def().node_size() << " nodes for "
+            << signatures.size() << " signature(s).";
+
+  // Drop the signature defs that are no longer backed by the graph.
+  for (auto it = signature_map.begin(); it != signature_map.end();) {
+    if (signatures.count(it->first) == 0) {
+      it = signature_map.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return Status::OK();
+}
+
 Status LoadSavedModel(const SessionOptions& session_options,
                       const RunOptions& run_options, const string& export_dir,
                       const std::unordered_set<string>& tags,
@@ -112,6 +112,17 @@ Status LoadMetagraphIntoSession(const SessionOptions& session_options,
                                 const MetaGraphDef& meta_graph,
                                 std::unique_ptr<Session>* session);
 
+/// Prunes `meta_graph_def`'s graph to the nodes needed by the given
+/// signatures (plus the model's initialization op), and drops the other
+/// signature defs. Useful when a replica serves a subset of a model's
+/// signatures: applied between reading and loading the MetaGraphDef, it
+/// avoids instantiating kernels and constants for graph regions the replica
+/// will never run. `signatures` must name signatures present in
+/// `meta_graph_def`; `export_dir` is used to locate the init op.
+Status PruneMetaGraphForSignatures(
+    const string& export_dir, const std::unordered_set<string>& signatures,
+    MetaGraphDef* meta_graph_def);
+
 /// Loads a SavedModel from the specified export directory. The MetaGraphDef
 /// to be loaded is identified by the supplied tags, corresponding exactly to
 /// the set of tags used at SavedModel build time. Stores a SavedModel bundle in
@@ -174,6 +174,62 @@ TEST_F(LoaderTest, RestoreSession) {
   CheckSavedModelBundle(export_dir, actual_bundle);
 }
 
+TEST_F(LoaderTest, PruneMetaGraphForSignatures) {
+  SessionOptions session_options;
+  RunOptions run_options;
+
+  const string export_dir =
+      io::JoinPath(testing::TensorFlowSrcRoot(), kTestDataSharded);
+  SavedModelBundle bundle;
+  const std::unordered_set<std::string> tags = {kSavedModelTagServe};
+  TF_ASSERT_OK(ReadMetaGraphDefFromSavedModel(export_dir, tags,
+                                              &bundle.meta_graph_def));
+
+  const int original_nodes = bundle.meta_graph_def.graph_def().node_size();
+  TF_ASSERT_OK(PruneMetaGraphForSignatures(export_dir, {"regress_x_to_y"},
+                                           &bundle.meta_graph_def));
+  // Pruning drops graph regions and signature defs that only back the other
+  // signatures.
+  EXPECT_LT(bundle.meta_graph_def.graph_def().node_size(), original_nodes);
+  EXPECT_EQ(bundle.meta_graph_def.signature_def().count("regress_x_to_y"), 1);
+  EXPECT_EQ(bundle.meta_graph_def.signature_def().count("classify_x_to_y"), 0);
+
+  // The pruned metagraph must still load, restore, and serve the kept
+  // signature.
+  TF_ASSERT_OK(LoadMetagraphIntoSession(session_options,
+                                        bundle.meta_graph_def,
+                                        &bundle.session));
+  TF_ASSERT_OK(RestoreSession(run_options, bundle.meta_graph_def, export_dir,
+                              &bundle.session));
+  const auto& signature_def =
+      bundle.meta_graph_def.signature_def().at("regress_x_to_y");
+  const string input_name = signature_def.inputs().at(kRegressInputs).name();
+  const string output_name = signature_def.outputs().at(kRegressOutputs).name();
+  Tensor input = test::AsTensor<tstring>(
+      {MakeSerializedExample(0.0f), MakeSerializedExample(2.0f)},
+      TensorShape({2}));
+  std::vector<Tensor> outputs;
+  TF_ASSERT_OK(
+      bundle.session->Run({{input_name, input}}, {output_name}, {}, &outputs));
+  ASSERT_EQ(outputs.size(), 1);
+  test::ExpectTensorEqual<float>(
+      outputs[0], test::AsTensor<float>({2, 3}, TensorShape({2, 1})));
+}
+
+TEST_F(LoaderTest, PruneMetaGraphForSignaturesNotFound) {
+  const string export_dir =
+      io::JoinPath(testing::TensorFlowSrcRoot(), kTestDataSharded);
+  MetaGraphDef meta_graph_def;
+  TF_ASSERT_OK(ReadMetaGraphDefFromSavedModel(
+      export_dir, {kSavedModelTagServe}, &meta_graph_def));
+  Status st = PruneMetaGraphForSignatures(export_dir, {"no_such_signature"},
+                                          &meta_graph_def);
+  EXPECT_FALSE(st.ok());
+  EXPECT_TRUE(absl::StrContains(st.error_message(),
+                                "Signature not found in SavedModel"))
+      << st.error_message();
+}
+
 TEST_F(LoaderTest, NoTagMatch) {
   SavedModelBundle bundle;
   RunOptions run_options;
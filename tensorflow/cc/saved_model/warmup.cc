@@ -0,0 +1,128 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/cc/saved_model/warmup.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/protobuf/meta_graph.pb.h"
+
+namespace tensorflow {
+namespace internal {
+
+Status SynthesizeWarmupInput(const TensorInfo& info, int batch_size,
+                             Tensor* out) {
+  if (info.encoding_case() != TensorInfo::kName) {
+    return errors::Unimplemented(
+        "Warmup supports only dense signature inputs; got a composite/coo "
+        "input.");
+  }
+  TensorShape shape;
+  const TensorShapeProto& shape_proto = info.tensor_shape();
+  if (shape_proto.unknown_rank()) {
+    // A scalar is the only safe guess for fully unknown shapes.
+    shape = TensorShape({});
+  } else {
+    for (int d = 0; d < shape_proto.dim_size(); ++d) {
+      int64_t size = shape_proto.dim(d).size();
+      if (size < 0) {
+        size = (d == 0) ? batch_size : 1;
+      }
+      shape.AddDim(size);
+    }
+  }
+  Tensor tensor(info.dtype(), shape);
+  // Zero-fill the memcpy-able types; strings and variants default-construct
+  // to valid empty values already.
+  if (DataTypeCanUseMemcpy(info.dtype()) && tensor.NumElements() > 0) {
+    memset(const_cast<char*>(tensor.tensor_data().data()), 0,
+           tensor.tensor_data().size());
+  }
+  *out = std::move(tensor);
+  return Status::OK();
+}
+
+}  // namespace internal
+
+namespace {
+
+Status WarmupSignature(Session* session, const string& name,
+                       const SignatureDef& signature, int batch_size) {
+  std::vector<std::pair<string, Tensor>> feeds;
+  feeds.reserve(signature.inputs_size());
+  for (const auto& name_and_info : signature.inputs()) {
+    Tensor input;
+    TF_RETURN_IF_ERROR(internal::SynthesizeWarmupInput(name_and_info.second,
+                                                       batch_size, &input));
+    feeds.emplace_back(name_and_info.second.name(), std::move(input));
+  }
+  std::vector<string> fetches;
+  fetches.reserve(signature.outputs_size());
+  for (const auto& name_and_info : signature.outputs()) {
+    fetches.push_back(name_and_info.second.name());
+  }
+  if (fetches.empty()) {
+    // Initializer-style signatures have nothing to warm.
+    return Status::OK();
+  }
+  std::vector<Tensor> unused_outputs;
+  return session->Run(feeds, fetches, /*target_node_names=*/{},
+                      &unused_outputs);
+}
+
+}  // namespace
+
+Status WarmupSavedModel(const SavedModelBundleInterface& bundle,
+                        const WarmupOptions& options) {
+  Session* session = bundle.GetSession();
+  if (session == nullptr) {
+    return errors::InvalidArgument("Bundle has no session to warm up.");
+  }
+  Status first_error;
+  for (const auto& name_and_signature : bundle.GetSignatures()) {
+    const string& name = name_and_signature.first;
+    if (!options.signature_names.empty() &&
+        std::find(options.signature_names.begin(),
+                  options.signature_names.end(),
+                  name) == options.signature_names.end()) {
+      continue;
+    }
+    for (int batch_size : options.batch_sizes) {
+      Status status = WarmupSignature(session, name, name_and_signature.second,
+                                      batch_size);
+      if (!status.ok()) {
+        LOG(WARNING) << "Warmup of signature '" << name << "' at batch size "
+                     << batch_size << " failed: " << status;
+        if (first_error.ok()) {
+          first_error = status;
+        }
+        // A signature that fails at one batch size will likely fail at the
+        // others too; move on to the next signature.
+        break;
+      }
+    }
+  }
+  return first_error;
+}
+
+}  // namespace tensorflow
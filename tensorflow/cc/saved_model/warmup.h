@@ -0,0 +1,65 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CC_SAVED_MODEL_WARMUP_H_
+#define TENSORFLOW_CC_SAVED_MODEL_WARMUP_H_
+
+#include <vector>
+
+#include "tensorflow/cc/saved_model/loader.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/lib/core/status.h"
+#include "tensorflow/core/protobuf/meta_graph.pb.h"
+
+namespace tensorflow {
+
+// A function used by the implementation, and exposed for testing only.
+namespace internal {
+
+// Builds a zero-filled tensor for `info`, resolving unknown dimensions: the
+// leading dimension becomes `batch_size`, inner unknown dimensions become 1.
+// Returns Unimplemented for non-dense (composite) inputs.
+Status SynthesizeWarmupInput(const TensorInfo& info, int batch_size,
+                             Tensor* out);
+
+}  // namespace internal
+
+// Options controlling WarmupSavedModel.
+struct WarmupOptions {
+  // Batch sizes to exercise per signature: each signature is executed once
+  // per batch size, with every unknown leading dimension set to that size.
+  // This instantiates kernels, grows allocator pools and triggers
+  // autotuning for each shape class the serving traffic will use (e.g. the
+  // batcher's allowed_batch_sizes). Defaults to a single size-1 run.
+  std::vector<int> batch_sizes = {1};
+
+  // Signatures to warm up. Empty means all signatures in the bundle (except
+  // initializer-only ones without outputs).
+  std::vector<string> signature_names;
+};
+
+// Executes the bundle's signatures with synthesized inputs so that first
+// production requests hit warm state: kernels are instantiated, allocator
+// pools are grown to steady-state sizes, and autotuners have run. Inputs are
+// zero-filled tensors shaped from each signature's TensorInfo, with unknown
+// dimensions resolved to the warmup batch size (leading) or 1 (inner).
+// Returns the first error encountered; a failed signature does not stop the
+// remaining ones from being warmed.
+Status WarmupSavedModel(const SavedModelBundleInterface& bundle,
+                        const WarmupOptions& options);
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CC_SAVED_MODEL_WARMUP_H_
@@ -0,0 +1,136 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/cc/saved_model/warmup.h"
+
+#include "tensorflow/cc/saved_model/loader.h"
+#include "tensorflow/cc/saved_model/tag_constants.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/lib/io/path.h"
+#include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/platform/test.h"
+#include "tensorflow/core/protobuf/error_codes.pb.h"
+#include "tensorflow/core/protobuf/meta_graph.pb.h"
+
+namespace tensorflow {
+namespace {
+
+constexpr char kTestDataSharded[] =
+    "cc/saved_model/testdata/half_plus_two/00000123";
+
+TEST(SynthesizeWarmupInputTest, KnownShape) {
+  TensorInfo info;
+  info.set_name("x:0");
+  info.set_dtype(DT_FLOAT);
+  info.mutable_tensor_shape()->add_dim()->set_size(2);
+  info.mutable_tensor_shape()->add_dim()->set_size(3);
+  Tensor input;
+  TF_ASSERT_OK(internal::SynthesizeWarmupInput(info, /*batch_size=*/8, &input));
+  EXPECT_EQ(input.dtype(), DT_FLOAT);
+  EXPECT_EQ(input.shape(), TensorShape({2, 3}));
+  // Zero-filled.
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(input.flat<float>()(i), 0.0f);
+  }
+}
+
+TEST(SynthesizeWarmupInputTest, UnknownDimsResolve) {
+  // The unknown leading dimension becomes the batch size; unknown inner
+  // dimensions become 1.
+  TensorInfo info;
+  info.set_name("x:0");
+  info.set_dtype(DT_INT32);
+  info.mutable_tensor_shape()->add_dim()->set_size(-1);
+  info.mutable_tensor_shape()->add_dim()->set_size(5);
+  info.mutable_tensor_shape()->add_dim()->set_size(-1);
+  Tensor input;
+  TF_ASSERT_OK(internal::SynthesizeWarmupInput(info, /*batch_size=*/4, &input));
+  EXPECT_EQ(input.shape(), TensorShape({4, 5, 1}));
+}
+
+TEST(SynthesizeWarmupInputTest, UnknownRankBecomesScalar) {
+  TensorInfo info;
+  info.set_name("x:0");
+  info.set_dtype(DT_STRING);
+  info.mutable_tensor_shape()->set_unknown_rank(true);
+  Tensor input;
+  TF_ASSERT_OK(internal::SynthesizeWarmupInput(info, /*batch_size=*/4, &input));
+  EXPECT_EQ(input.shape(), TensorShape({}));
+}
+
+TEST(SynthesizeWarmupInputTest, CompositeInputIsUnimplemented) {
+  TensorInfo info;
+  info.set_dtype(DT_FLOAT);
+  info.mutable_coo_sparse()->set_values_tensor_name("values:0");
+  Tensor input;
+  Status status =
+      internal::SynthesizeWarmupInput(info, /*batch_size=*/1, &input);
+  EXPECT_EQ(status.code(), error::UNIMPLEMENTED);
+}
+
+class WarmupSavedModelTest : public ::testing::Test {
+ protected:
+  void LoadBundle(SavedModelBundle* bundle) {
+    const string export_dir =
+        io::JoinPath(testing::TensorFlowSrcRoot(), kTestDataSharded);
+    TF_ASSERT_OK(LoadSavedModel(SessionOptions(), RunOptions(), export_dir,
+                                {kSavedModelTagServe}, bundle));
+  }
+};
+
+TEST_F(WarmupSavedModelTest, WarmsAllSignatures) {
+  SavedModelBundle bundle;
+  LoadBundle(&bundle);
+  TF_EXPECT_OK(WarmupSavedModel(bundle, WarmupOptions()));
+}
+
+TEST_F(WarmupSavedModelTest, WarmsSelectedSignatureAtSeveralBatchSizes) {
+  SavedModelBundle bundle;
+  LoadBundle(&bundle);
+  WarmupOptions options;
+  options.signature_names = {"regress_x_to_y"};
+  options.batch_sizes = {1, 4, 16};
+  TF_EXPECT_OK(WarmupSavedModel(bundle, options));
+}
+
+TEST_F(WarmupSavedModelTest, FailedSignatureDoesNotStopTheOthers) {
+  SavedModelBundle bundle;
+  LoadBundle(&bundle);
+  // Doctor in a signature whose output does not exist. Its warmup fails, the
+  // first error is reported, and the remaining (valid) signatures are still
+  // warmed rather than aborting the pass.
+  SignatureDef broken;
+  TensorInfo* input = &(*broken.mutable_inputs())["x"];
+  input->set_name("tf_example:0");
+  input->set_dtype(DT_STRING);
+  input->mutable_tensor_shape()->add_dim()->set_size(-1);
+  (*broken.mutable_outputs())["y"].set_name("no_such_node:0");
+  (*bundle.meta_graph_def.mutable_signature_def())["aaa_broken"] = broken;
+
+  Status status = WarmupSavedModel(bundle, WarmupOptions());
+  EXPECT_FALSE(status.ok());
+  EXPECT_TRUE(absl::StrContains(status.error_message(), "no_such_node"))
+      << status.error_message();
+
+  // The untouched signatures still warm cleanly on their own.
+  WarmupOptions good_only;
+  good_only.signature_names = {"regress_x_to_y"};
+  TF_EXPECT_OK(WarmupSavedModel(bundle, good_only));
+}
+
+}  // namespace
+}  // namespace tensorflow
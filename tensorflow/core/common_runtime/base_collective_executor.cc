@@ -16,6 +16,7 @@ limitations under the License.
 
 #include <algorithm>
 #include <functional>
+#include <unordered_map>
 #include <utility>
 
 #include "tensorflow/core/common_runtime/copy_tensor.h"
@@ -33,7 +34,9 @@ limitations under the License.
 #include "tensorflow/core/lib/core/notification.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/refcount.h"
 #include "tensorflow/core/platform/tracing.h"
 #include "tensorflow/core/platform/types.h"
@@ -50,6 +53,44 @@ bool IsCancelled(CancellationManager* cancel_mgr) {
   return cancel_mgr != nullptr &&
          (cancel_mgr->IsCancelled() || cancel_mgr->IsCancelling());
 }
+
+// Tracks per-collective completion times and warns when one completion is far
+// slower than that collective's recent history. This tier is reporting only:
+// the deadline that aborts a collective remains the static, group-agreed
+// timeout below, because an abort decision derived from locally observed
+// latencies would not be consistent across ranks.
+class CollectiveTimingReporter {
+ public:
+  static CollectiveTimingReporter* Global() {
+    static CollectiveTimingReporter* instance = new CollectiveTimingReporter;
+    return instance;
+  }
+
+  void RecordCompletion(const string& name, int64_t elapsed_micros) {
+    constexpr double kAlpha = 0.25;           // EWMA smoothing factor.
+    constexpr double kStragglerRatio = 4.0;   // Warn beyond 4x the average.
+    constexpr int64_t kMinReportMicros = 100 * 1000;
+    double ewma;
+    {
+      mutex_lock l(mu_);
+      auto it = ewma_micros_.emplace(name, static_cast<double>(elapsed_micros));
+      if (it.second) return;  // First observation; nothing to compare against.
+      ewma = it.first->second;
+      it.first->second = kAlpha * elapsed_micros + (1.0 - kAlpha) * ewma;
+    }
+    if (elapsed_micros >= kMinReportMicros &&
+        elapsed_micros > kStragglerRatio * ewma) {
+      LOG(WARNING) << "Collective " << name << " completed in "
+                   << elapsed_micros / 1000 << " ms vs. a recent average of "
+                   << static_cast<int64_t>(ewma) / 1000
+                   << " ms; this rank may be running with a straggler.";
+    }
+  }
+
+ private:
+  mutex mu_;
+  std::unordered_map<string, double> ewma_micros_ TF_GUARDED_BY(mu_);
+};
 }  // namespace
 
 /*static*/
@@ -275,9 +316,15 @@ void BaseCollectiveExecutor::ExecuteAsync(OpKernelContext* ctx,
                                           StatusCallback done) {
   // See CompleteParamsAsync() how done() and the timeout callback interacts.
   const auto is_callback_called = std::make_shared<std::atomic<bool>>(false);
-  auto done_safe = [this, done, ctx, is_callback_called](const Status& s) {
+  const int64_t launch_micros = Env::Default()->NowMicros();
+  auto done_safe = [this, done, ctx, is_callback_called, launch_micros,
+                    name = col_params->name](const Status& s) {
     bool called = is_callback_called->exchange(true);
     if (!called) {
+      if (s.ok()) {
+        CollectiveTimingReporter::Global()->RecordCompletion(
+            name, Env::Default()->NowMicros() - launch_micros);
+      }
       if (!s.ok() && !IsCancelled(ctx->cancellation_manager())) {
         // This is a collective error. Abort CollectiveExecutor so that this
         // error can propagate to other workers.
@@ -15,6 +15,9 @@ limitations under the License.
 
 #include "tensorflow/core/common_runtime/bfc_allocator.h"
 
+#include <cstdlib>
+#include <cstring>
+
 #include <algorithm>
 #include <atomic>
 #include <utility>
@@ -509,8 +512,44 @@ double BFCAllocator::GetFragmentation() {
          bytes_available;
 }
 
+bool BFCAllocator::AnnotationWatermarksEnabled() {
+  static const bool enabled = [] {
+    const char* value = std::getenv("TF_BFC_ANNOTATION_WATERMARKS");
+    return value != nullptr && strcmp(value, "1") == 0;
+  }();
+  return enabled;
+}
+
+void BFCAllocator::RecordAnnotatedAlloc(Chunk* chunk) {
+  if (!AnnotationWatermarksEnabled()) return;
+  const auto& annotation =
+      profiler::ScopedMemoryDebugAnnotation::CurrentAnnotation();
+  const char* op_name = annotation.pending_op_name;
+  if (op_name == nullptr || op_name[0] == '\0') {
+    op_name = "(unannotated)";
+  }
+  auto it_and_inserted =
+      annotation_ids_.emplace(op_name, annotation_names_.size());
+  if (it_and_inserted.second) {
+    annotation_names_.push_back(op_name);
+    annotation_stats_.emplace_back();
+  }
+  const int id = it_and_inserted.first->second;
+  chunk->annotation_id = id;
+  AnnotationStats& stats = annotation_stats_[id];
+  stats.live_bytes += chunk->size;
+  stats.peak_bytes = std::max(stats.peak_bytes, stats.live_bytes);
+}
+
+void BFCAllocator::RecordAnnotatedFree(Chunk* chunk) {
+  if (chunk->annotation_id < 0) return;
+  annotation_stats_[chunk->annotation_id].live_bytes -= chunk->size;
+  chunk->annotation_id = -1;
+}
+
 void BFCAllocator::AddTraceMe(absl::string_view traceme_name, const void* ptr) {
   BFCAllocator::Chunk* chunk = ChunkFromHandle(region_manager_.get_handle(ptr));
+  RecordAnnotatedAlloc(chunk);
   AddTraceMe(traceme_name, chunk->ptr, chunk->requested_size, chunk->size);
 }
 
@@ -691,6 +730,7 @@ void BFCAllocator::DeallocateRawInternal(void* ptr) {
   void* chunk_ptr = chunk->ptr;
   int64_t req_bytes = chunk->requested_size;
   int64_t alloc_bytes = chunk->size;
+  RecordAnnotatedFree(chunk);
 
   MarkFree(h);
 
@@ -1023,6 +1063,15 @@ string BFCAllocator::RenderOccupancy() {
 }
 
 void BFCAllocator::DumpMemoryLog(size_t num_bytes) {
+  if (AnnotationWatermarksEnabled() && !annotation_names_.empty()) {
+    LOG(INFO) << "Per-annotation memory watermarks for " << Name() << ":";
+    for (size_t i = 0; i < annotation_names_.size(); ++i) {
+      LOG(INFO) << "  " << annotation_names_[i]
+                << " live=" << annotation_stats_[i].live_bytes
+                << " peak=" << annotation_stats_[i].peak_bytes;
+    }
+  }
+
   const std::array<BinDebugInfo, kNumBins> bin_infos = get_bin_debug_info();
   LOG(INFO) << "BFCAllocator dump for " << Name();
   for (BinNum bin_num = 0; bin_num < kNumBins; bin_num++) {
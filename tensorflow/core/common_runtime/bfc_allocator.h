@@ -23,6 +23,7 @@ limitations under the License.
 #include <unordered_map>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "tensorflow/core/common_runtime/allocator_retry.h"
 #include "tensorflow/core/common_runtime/shared_counter.h"
@@ -140,6 +141,16 @@ class BFCAllocator : public Allocator {
   // Add TraceMe (in memory allocation and deallocation) for memory stats
   // profiling. The chunk_ptr is passed to get information such as address,
   // chunk size and requested_size.
+  // Per-annotation live/peak accounting, enabled by
+  // TF_BFC_ANNOTATION_WATERMARKS=1: each allocation is charged to the
+  // pending ScopedMemoryDebugAnnotation's op name and released on free, so
+  // the OOM dump can name the ops whose allocation pattern drove the
+  // high-water mark. Maintained under lock_, which both paths already
+  // hold.
+  static bool AnnotationWatermarksEnabled();
+  void RecordAnnotatedAlloc(Chunk* chunk) TF_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  void RecordAnnotatedFree(Chunk* chunk) TF_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
   void AddTraceMe(absl::string_view traceme_name, const void* ptr)
       TF_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
@@ -175,6 +186,11 @@ class BFCAllocator : public Allocator {
   struct Chunk {
     size_t size = 0;  // Full size of buffer.
 
+    // Index into annotation_names_ of the ScopedMemoryDebugAnnotation that
+    // was pending when this chunk was allocated, or -1. Only maintained
+    // when annotation watermark tracking is enabled.
+    int annotation_id = -1;
+
     // We sometimes give chunks that are larger than needed to reduce
     // fragmentation.  requested_size keeps track of what the client
     // actually wanted so we can understand whether our splitting
@@ -596,6 +612,15 @@ class BFCAllocator : public Allocator {
 
   // Structures mutable after construction
   mutable mutex lock_;
+
+  // Annotation watermark state; see RecordAnnotatedAlloc.
+  struct AnnotationStats {
+    int64_t live_bytes = 0;
+    int64_t peak_bytes = 0;
+  };
+  std::vector<string> annotation_names_ TF_GUARDED_BY(lock_);
+  absl::flat_hash_map<string, int> annotation_ids_ TF_GUARDED_BY(lock_);
+  std::vector<AnnotationStats> annotation_stats_ TF_GUARDED_BY(lock_);
   RegionManager region_manager_ TF_GUARDED_BY(lock_);
 
   std::vector<Chunk> chunks_ TF_GUARDED_BY(lock_);
@@ -687,8 +687,17 @@ void CollectiveParamResolverLocal::AssignCollectiveType(CollectiveParams* cp) {
   // After enough testing, we may simplify this logic to use NCCL whenever
   // available.
   CollectiveImplementationInterface* col_impl;
+  // Single-task GPU groups additionally default to NCCL when it is linked
+  // in: the intra-host half of a reduction is exactly where the flat ring
+  // over PCIe/NVLink loses to NCCL's topology-aware rings, and no
+  // cross-worker transport is involved. An explicit "ring" hint still
+  // forces the ring implementations.
+  const bool intra_host_gpu_group =
+      cp->group.device_type == DEVICE_GPU && cp->group.num_tasks == 1 &&
+      cp->instance.impl_details.communication_hint != "ring";
   bool use_nccl =
-      (nccl_ || cp->instance.impl_details.communication_hint == "nccl") &&
+      (nccl_ || cp->instance.impl_details.communication_hint == "nccl" ||
+       intra_host_gpu_group) &&
       cp->group.device_type == DEVICE_GPU &&
       CollectiveRegistry::LookupParamResolverInstance("NcclReduce", &col_impl)
           .ok();
@@ -22,6 +22,7 @@ namespace tensorflow {
 constexpr char kTpuCostName[] = "tpu";
 constexpr char kGcuCostName[] = "gcu";
 constexpr char kNoOpCostName[] = "no_op";
+constexpr char kCpuCostName[] = "cpu";
 
 // Each type of per-request cost could have the following versions.
 //
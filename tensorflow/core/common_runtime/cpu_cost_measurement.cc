@@ -0,0 +1,63 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/cpu_cost_measurement.h"
+
+#include <time.h>
+
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "tensorflow/core/common_runtime/cost_constants.h"
+#include "tensorflow/core/common_runtime/cost_measurement_registry.h"
+
+namespace tensorflow {
+namespace {
+
+// Returns this thread's consumed CPU time, or a negative duration when the
+// platform does not expose a thread CPU clock.
+absl::Duration ThreadCpuTime() {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+    return absl::Seconds(ts.tv_sec) + absl::Nanoseconds(ts.tv_nsec);
+  }
+#endif
+  return absl::Seconds(-1);
+}
+
+}  // namespace
+
+CpuCostMeasurement::CpuCostMeasurement(const Context& context)
+    : CostMeasurement(context), start_cpu_time_(ThreadCpuTime()) {}
+
+absl::Duration CpuCostMeasurement::GetTotalCost() {
+  if (start_cpu_time_ < absl::ZeroDuration()) {
+    return absl::ZeroDuration();
+  }
+  const absl::Duration now = ThreadCpuTime();
+  if (now < start_cpu_time_) {
+    // Different thread (or clock failure): no meaningful attribution.
+    return absl::ZeroDuration();
+  }
+  return now - start_cpu_time_;
+}
+
+absl::string_view CpuCostMeasurement::GetCostType() const {
+  return kCpuCostName;
+}
+
+REGISTER_COST_MEASUREMENT(kCpuCostName, CpuCostMeasurement);
+
+}  // namespace tensorflow
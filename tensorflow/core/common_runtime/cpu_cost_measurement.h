@@ -0,0 +1,48 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_COMMON_RUNTIME_CPU_COST_MEASUREMENT_H_
+#define TENSORFLOW_CORE_COMMON_RUNTIME_CPU_COST_MEASUREMENT_H_
+
+#include "absl/strings/string_view.h"
+#include "absl/time/time.h"
+#include "tensorflow/core/common_runtime/cost_measurement.h"
+
+namespace tensorflow {
+
+// Measures the CPU time consumed by the measuring thread over the
+// measurement scope, using the per-thread CPU clock: two clock reads per
+// request, no synchronization, cheap enough to keep always-on. Captures the
+// request-handler thread's share of a request (parsing, batching, dispatch,
+// inline kernels); work handed to other threads is attributed to their own
+// measurement scopes.
+class CpuCostMeasurement : public CostMeasurement {
+ public:
+  explicit CpuCostMeasurement(const Context& context);
+
+  // Returns the CPU time this thread consumed since construction. Returns
+  // zero if called from a different thread than the constructor.
+  absl::Duration GetTotalCost() override;
+  absl::string_view GetCostType() const override;
+
+ private:
+  // CPU time consumed by the constructing thread at construction, or a
+  // negative duration when the platform has no thread CPU clock.
+  absl::Duration start_cpu_time_;
+};
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_COMMON_RUNTIME_CPU_COST_MEASUREMENT_H_
@@ -63,6 +63,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/lib/core/threadpool_options.h"
 #include "tensorflow/core/lib/gtl/array_slice.h"
+#include "tensorflow/core/lib/hash/hash.h"
 #include "tensorflow/core/lib/monitoring/counter.h"
 #include "tensorflow/core/lib/random/random.h"
 #include "tensorflow/core/lib/strings/numbers.h"
@@ -661,6 +662,8 @@ Status DirectSession::RunInternal(
   args.sync_on_finish = sync_on_finish_;
   args.user_intra_op_threadpool = threadpool_options.intra_op_threadpool;
   args.run_all_kernels_inline = pool == nullptr;
+  args.enable_sharded_dispatch =
+      options_.config.experimental().use_sharded_ready_dispatch();
   args.start_time_usecs = start_time_usecs;
   args.deadline = deadline;
 
@@ -1472,6 +1475,31 @@ Status DirectSession::CreateExecutors(
   return Status::OK();
 }
 
+namespace {
+
+// Computes an order-sensitive fingerprint of a Run() signature without
+// materializing the concatenated signature string. Section sizes are mixed in
+// so that moving a name between the feed/fetch/target lists changes the
+// fingerprint.
+uint64 RunSignatureFingerprint(gtl::ArraySlice<string> inputs,
+                               gtl::ArraySlice<string> outputs,
+                               gtl::ArraySlice<string> target_nodes) {
+  uint64 h = Hash64Combine(inputs.size(), Hash64Combine(outputs.size(),
+                                                        target_nodes.size()));
+  for (const string& name : inputs) {
+    h = Hash64(name.data(), name.size(), h);
+  }
+  for (const string& name : outputs) {
+    h = Hash64(name.data(), name.size(), h);
+  }
+  for (const string& name : target_nodes) {
+    h = Hash64(name.data(), name.size(), h);
+  }
+  return h;
+}
+
+}  // namespace
+
 Status DirectSession::GetOrCreateExecutors(
     gtl::ArraySlice<string> inputs, gtl::ArraySlice<string> outputs,
     gtl::ArraySlice<string> target_nodes, ExecutorsAndKeys** executors_and_keys,
@@ -1487,6 +1515,34 @@ Status DirectSession::GetOrCreateExecutors(
         run_state_args->debug_options.debug_tensor_watch_opts());
   }
 
+  // Fingerprint fast path: for the common case (no partial run, no debug
+  // tensor watches, no memory logging), find the executors for a previously
+  // seen signature by fingerprinting the feed/fetch/target names directly,
+  // without materializing or hashing the concatenated signature string.
+  const bool use_fingerprint_lookup = handle_name_counter_value < 0 &&
+                                      !run_state_args->is_partial_run &&
+                                      debug_tensor_watches_summary.empty();
+  uint64 signature_fingerprint = 0;
+  if (use_fingerprint_lookup) {
+    signature_fingerprint =
+        RunSignatureFingerprint(inputs, outputs, target_nodes);
+    mutex_lock l(executor_lock_);
+    auto it = executors_by_fingerprint_.find(signature_fingerprint);
+    if (it != executors_by_fingerprint_.end()) {
+      const SignatureFingerprintEntry& entry = it->second;
+      // Guard against fingerprint collisions by comparing the actual names.
+      if (std::equal(entry.inputs.begin(), entry.inputs.end(), inputs.begin(),
+                     inputs.end()) &&
+          std::equal(entry.outputs.begin(), entry.outputs.end(),
+                     outputs.begin(), outputs.end()) &&
+          std::equal(entry.target_nodes.begin(), entry.target_nodes.end(),
+                     target_nodes.begin(), target_nodes.end())) {
+        *executors_and_keys = entry.executors_and_keys;
+        return Status::OK();
+      }
+    }
+  }
+
   // Fast lookup path, no sorting.
   const string key = strings::StrCat(
       absl::StrJoin(inputs, ","), "->", absl::StrJoin(outputs, ","), "/",
@@ -1583,6 +1639,20 @@ Status DirectSession::GetOrCreateExecutors(
   executors_.emplace(key, insert_result.first->second);
   *executors_and_keys = insert_result.first->second.get();
 
+  // Populate the fingerprint fast path for subsequent calls with this exact
+  // signature. On a (vanishingly unlikely) fingerprint collision, the first
+  // signature keeps the slot and later ones fall back to the string keys.
+  if (use_fingerprint_lookup) {
+    SignatureFingerprintEntry& entry =
+        executors_by_fingerprint_[signature_fingerprint];
+    if (entry.executors_and_keys == nullptr) {
+      entry.inputs.assign(inputs.begin(), inputs.end());
+      entry.outputs.assign(outputs.begin(), outputs.end());
+      entry.target_nodes.assign(target_nodes.begin(), target_nodes.end());
+      entry.executors_and_keys = insert_result.first->second.get();
+    }
+  }
+
   return Status::OK();
 }
 
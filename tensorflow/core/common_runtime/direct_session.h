@@ -367,6 +367,20 @@ class DirectSession : public Session {
   std::unordered_map<string, std::shared_ptr<ExecutorsAndKeys>> executors_
       TF_GUARDED_BY(executor_lock_);
 
+  // Fast-path executor lookup keyed by a fingerprint of the (unsorted)
+  // feed/fetch/target names, so that steady-state Run() calls with a fixed
+  // signature avoid building and hashing the concatenated signature string.
+  // The stored name lists are used to verify the match on a fingerprint hit;
+  // `executors_and_keys` aliases an object owned by `executors_`.
+  struct SignatureFingerprintEntry {
+    std::vector<string> inputs;
+    std::vector<string> outputs;
+    std::vector<string> target_nodes;
+    ExecutorsAndKeys* executors_and_keys = nullptr;
+  };
+  std::unordered_map<uint64, SignatureFingerprintEntry>
+      executors_by_fingerprint_ TF_GUARDED_BY(executor_lock_);
+
   class RunCallableCallFrame;
   struct Callable {
     std::shared_ptr<ExecutorsAndKeys> executors_and_keys;
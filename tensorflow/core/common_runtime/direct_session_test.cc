@@ -153,6 +153,39 @@ TEST_F(DirectSessionMinusAXTest, RunSimpleNetwork) {
   EXPECT_FLOAT_EQ(5.0, mat(0, 0));
 }
 
+TEST_F(DirectSessionMinusAXTest, RepeatedRunsWithSameSignature) {
+  Initialize({3, 2, -1, 0});
+  auto session = CreateSession();
+  ASSERT_TRUE(session != nullptr);
+  TF_ASSERT_OK(session->Create(def_));
+  std::vector<std::pair<string, Tensor>> inputs;
+
+  // The first Run creates the executors; subsequent Runs with the identical
+  // signature must find them again (via the fingerprint fast path) and keep
+  // producing the same results.
+  std::vector<string> output_names = {y_ + ":0"};
+  std::vector<string> target_nodes = {y_neg_};
+  for (int i = 0; i < 3; ++i) {
+    std::vector<Tensor> outputs;
+    TF_ASSERT_OK(session->Run(inputs, output_names, target_nodes, &outputs));
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_FLOAT_EQ(5.0, outputs[0].matrix<float>()(0, 0));
+  }
+
+  // Moving a name between the fetch and target lists is a different
+  // signature and must not alias the cached executors.
+  std::vector<Tensor> outputs;
+  TF_ASSERT_OK(session->Run(inputs, {y_neg_ + ":0"}, {}, &outputs));
+  ASSERT_EQ(1, outputs.size());
+  EXPECT_FLOAT_EQ(-5.0, outputs[0].matrix<float>()(0, 0));
+
+  // And the original signature still resolves correctly afterwards.
+  outputs.clear();
+  TF_ASSERT_OK(session->Run(inputs, output_names, target_nodes, &outputs));
+  ASSERT_EQ(1, outputs.size());
+  EXPECT_FLOAT_EQ(5.0, outputs[0].matrix<float>()(0, 0));
+}
+
 TEST_F(DirectSessionMinusAXTest, RunSimpleNetwork_Callable) {
   Initialize({3, 2, -1, 0});
   auto session = CreateSession();
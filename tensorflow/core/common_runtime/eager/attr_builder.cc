@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "tensorflow/core/common_runtime/eager/attr_builder.h"
 
+#include "absl/container/flat_hash_map.h"
+
 #include "tensorflow/core/common_runtime/device_factory.h"
 #include "tensorflow/core/common_runtime/rendezvous_mgr.h"
 #include "tensorflow/core/framework/allocator.h"
@@ -285,14 +287,19 @@ void CombineUnordered(const tensorflow::Fprint128& a,
   b->high64 += a.high64;
 }
 
-inline tensorflow::Fprint128 CacheKeyHelper(StringPiece s,
-                                            const tensorflow::Fprint128& b) {
-  tensorflow::Fprint128 a = tensorflow::Fingerprint128(s);
-  return FingerprintCat128(a, b);
-}
-
-inline tensorflow::Fprint128 CacheKeyHelper(StringPiece s, uint64 b) {
-  return CacheKeyHelper(s, {b, b});
+// Memoized Fingerprint128 for schema-derived strings (op names, attr names,
+// device names). Eager dispatch rebuilds cache keys once per op, but these
+// strings are drawn from a small fixed universe, so intern their
+// fingerprints. The table is thread-local: no synchronization on the
+// dispatch path, at the cost of one copy of the (small) table per thread.
+tensorflow::Fprint128 InternedFingerprint(StringPiece s) {
+  static thread_local auto* table =
+      new absl::flat_hash_map<string, tensorflow::Fprint128>();
+  auto it = table->find(s);
+  if (it != table->end()) return it->second;
+  tensorflow::Fprint128 f = tensorflow::Fingerprint128(s);
+  table->emplace(string(s), f);
+  return f;
 }
 
 }  // namespace
@@ -308,11 +315,15 @@ tensorflow::Fprint128 AttrBuilder::CacheKey(const StringPiece device) {
 
 tensorflow::Fprint128 AttrBuilder::BuildCacheKeyForDevice(
     const StringPiece device) const {
-  tensorflow::Fprint128 f = tensorflow::Fingerprint128(op_name());
-  f = tensorflow::FingerprintCat128(f, tensorflow::Fingerprint128(device));
+  tensorflow::Fprint128 f = InternedFingerprint(op_name());
+  f = tensorflow::FingerprintCat128(f, InternedFingerprint(device));
+  // Common case: ops dispatched with no explicit attrs hash nothing at all.
+  if (encoded_attrs_.empty()) return f;
   for (const auto& p : encoded_attrs_) {
-    CombineUnordered(
-        CacheKeyHelper(p.first, tensorflow::Fingerprint128(p.second)), &f);
+    CombineUnordered(tensorflow::FingerprintCat128(
+                         InternedFingerprint(p.first),
+                         tensorflow::Fingerprint128(p.second)),
+                     &f);
   }
   return f;
 }
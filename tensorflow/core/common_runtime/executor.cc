@@ -15,6 +15,9 @@ limitations under the License.
 
 #include "tensorflow/core/common_runtime/executor.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <atomic>
 #include <memory>
 #include <vector>
@@ -56,6 +59,7 @@ limitations under the License.
 #include "tensorflow/core/lib/gtl/flatmap.h"
 #include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/lib/gtl/manual_constructor.h"
+#include "tensorflow/core/lib/monitoring/sampler.h"
 #include "tensorflow/core/lib/hash/hash.h"
 #include "tensorflow/core/platform/context.h"
 #include "tensorflow/core/platform/env.h"
@@ -160,30 +164,54 @@ class ExecutorImpl : public Executor {
     KernelStats() = default;
 
     void Initialize(const GraphView& gview) {
-      is_expensive_.resize(gview.num_nodes());
+      is_expensive_ = absl::make_unique<std::atomic<bool>[]>(gview.num_nodes());
       cost_estimates_ =
           absl::make_unique<std::atomic_uint_fast64_t[]>(gview.num_nodes());
+      if (OpLatencyHistogramsEnabled()) {
+        latency_cells_ =
+            absl::make_unique<monitoring::SamplerCell*[]>(gview.num_nodes());
+      }
       for (int32_t i = 0; i < gview.num_nodes(); ++i) {
         if (gview.node(i)) {
           is_expensive_[i] =
               gview.node(i)->kernel && gview.node(i)->kernel->IsExpensive();
-          cost_estimates_[i] = kInitialCostEstimateCycles;
+          // Expensive-marked kernels start out with a high estimate so they
+          // stay in the threadpool until measured. Cheap-marked kernels start
+          // at zero so that the sampled EWMA below only promotes them if
+          // their measured cost genuinely exceeds the threshold.
+          cost_estimates_[i] = is_expensive_[i] ? kInitialCostEstimateCycles : 0;
+          if (latency_cells_ != nullptr && gview.node(i)->kernel != nullptr) {
+            // Cells are resolved once here so that the per-invocation work in
+            // Process() is a single lock-free histogram Add; GetCell takes a
+            // process-global lock and allocates the label string.
+            latency_cells_[i] = OpLatencyHistogram()->GetCell(
+                string(gview.node(i)->kernel->type_string_view()));
+          }
         }
       }
     }
 
+    // Returns the node's pre-resolved op-latency histogram cell, or nullptr
+    // when latency histograms are disabled (or the node has no kernel).
+    monitoring::SamplerCell* LatencyCell(const NodeItem& node) const {
+      return latency_cells_ == nullptr ? nullptr
+                                       : latency_cells_[node.node_id];
+    }
+
     // Returns true iff the given node is considered "expensive". The
     // executor uses this flag to optimize graph execution, for example
     // by "inlining" inexpensive kernels.
     bool IsExpensive(const NodeItem& node) const {
-      return is_expensive_[node.node_id] &&
+      return is_expensive_[node.node_id].load(std::memory_order_relaxed) &&
              (cost_estimates_[node.node_id].load(std::memory_order_relaxed) >
               kOpIsExpensiveThresholdCycles);
     }
 
-    // Returns the value of kernel->IsExpensive().
+    // Returns the current value of the expensive marker. It starts out as
+    // kernel->IsExpensive() and may be promoted to true by UpdateCostEstimate
+    // if a nominally-cheap kernel turns out to run long.
     bool HasExpensiveMarker(const NodeItem& node) const {
-      return is_expensive_[node.node_id];
+      return is_expensive_[node.node_id].load(std::memory_order_relaxed);
     }
 
     // Updates the dynamic cost estimate, which is used to determine whether the
@@ -201,6 +229,15 @@ class ExecutorImpl : public Executor {
           ((kCostDecay - 1) * prev_estimate + elapsed_cycles) / kCostDecay;
 
       cost_estimate.store(new_estimate, std::memory_order_relaxed);
+
+      // Promote a nominally-cheap kernel whose measured cost has risen above
+      // the threshold, so it stops being inlined on the scheduling thread.
+      // (Demotion is handled by IsExpensive(), which consults the current
+      // estimate on every call.)
+      if (new_estimate > kOpIsExpensiveThresholdCycles &&
+          !is_expensive_[node.node_id].load(std::memory_order_relaxed)) {
+        is_expensive_[node.node_id].store(true, std::memory_order_relaxed);
+      }
     }
 
    private:
@@ -211,9 +248,31 @@ class ExecutorImpl : public Executor {
     static constexpr uint64 kOpIsExpensiveThresholdCycles = 8000;
     static constexpr uint64 kCostDecay = 10;
 
-    std::vector<bool> is_expensive_;
-    // std::unique_ptr<std::atomic<bool>[]> is_expensive_;
+    // Per-invocation execution latency of synchronous kernels, in CPU
+    // cycles, bucketed by op type. On by default; deployments that cannot
+    // afford the sampled updates opt out with
+    // TF_DISABLE_OP_LATENCY_HISTOGRAMS=1.
+    static bool OpLatencyHistogramsEnabled() {
+      static const bool enabled = [] {
+        const char* value = std::getenv("TF_DISABLE_OP_LATENCY_HISTOGRAMS");
+        return value == nullptr || strcmp(value, "1") != 0;
+      }();
+      return enabled;
+    }
+
+    static monitoring::Sampler<1>* OpLatencyHistogram() {
+      static auto* histogram = monitoring::Sampler<1>::New(
+          {"/tensorflow/core/executor_op_latency_cycles",
+           "Sampled per-invocation execution latency, in CPU cycles, of "
+           "synchronous kernels, bucketed by op type.",
+           "op_type"},
+          monitoring::Buckets::Exponential(100, 2, 28));
+      return histogram;
+    }
+
+    std::unique_ptr<std::atomic<bool>[]> is_expensive_;
     std::unique_ptr<std::atomic_uint_fast64_t[]> cost_estimates_;
+    std::unique_ptr<monitoring::SamplerCell*[]> latency_cells_;
   };
 
   ImmutableExecutorState immutable_state_;
@@ -378,6 +437,7 @@ class ExecutorState {
   Executor::Args::Runner runner_;
   bool sync_on_finish_;
   const bool run_all_kernels_inline_;
+  const bool sharded_dispatch_;
 
   PropagatorStateType propagator_;
 
@@ -425,6 +485,7 @@ ExecutorState<PropagatorStateType>::ExecutorState(
       runner_(args.runner),
       sync_on_finish_(args.sync_on_finish),
       run_all_kernels_inline_(args.run_all_kernels_inline),
+      sharded_dispatch_(args.enable_sharded_dispatch),
       propagator_(immutable_state, step_id_, vlog_),
       num_outstanding_ops_(0) {
   if (args.user_intra_op_threadpool != nullptr) {
@@ -579,19 +640,28 @@ Status ExecutorState<PropagatorStateType>::ProcessSync(
         },
         profiler::GetTFTraceMeLevel(is_expensive));
     device->Compute(op_kernel, &ctx);
-  } else if (kernel_stats_->HasExpensiveMarker(item)) {
+  } else {
     KernelTimer timer;
     device->Compute(op_kernel, &ctx);
     // For expensive kernels, always update the cost estimate. For inexpensive
     // kernels, update the cost estimate with ~1/16 probability. This assumes
     // that the last 4 bits of the CPU cycle count is uniformly distributed.
+    // Nominally-cheap kernels are sampled too so that a mis-marked kernel is
+    // eventually promoted out of inline execution; the extra cycle-counter
+    // read is trivial next to a kernel invocation.
     constexpr int kKernelExecutionTrackingInvocationSkipCount = 16;
     if (is_expensive ||
         timer.start_cycles % kKernelExecutionTrackingInvocationSkipCount == 0) {
-      kernel_stats_->UpdateCostEstimate(item, timer.ElapsedCycles());
+      const uint64 elapsed_cycles = timer.ElapsedCycles();
+      kernel_stats_->UpdateCostEstimate(item, elapsed_cycles);
+      // Always-on production telemetry, sampled on the same schedule as the
+      // cost estimate. The histogram cell was resolved per node at executor
+      // initialization, so the steady-state overhead here is one lock-free
+      // Add per sampled invocation.
+      if (monitoring::SamplerCell* cell = kernel_stats_->LatencyCell(item)) {
+        cell->Add(static_cast<double>(elapsed_cycles));
+      }
     }
-  } else {
-    device->Compute(op_kernel, &ctx);
   }
   nodestats::SetOpEnd(stats);
   if (outputs->size() < item.num_outputs) outputs->resize(item.num_outputs);
@@ -1188,9 +1258,32 @@ void ExecutorState<PropagatorStateType>::ScheduleReady(
   } else {
     const TaggedNode* curr_expensive_node = nullptr;
     if (inline_ready == nullptr) {
-      // Schedule to run all the ready ops in thread pool.
-      for (auto& tagged_node : *ready) {
-        RunTask([=]() { Process(tagged_node, scheduled_nsec); });
+      // The number of dispatch shards is chosen so that each shard has at
+      // least `kMinNodesPerShard` nodes, up to `kMaxShards` tasks. Both
+      // constants are deliberately conservative: sharding only pays off when
+      // the fan-out is wide enough that per-node task dispatch would thrash
+      // the thread pool queues.
+      static constexpr size_t kMinNodesPerShard = 4;
+      static constexpr size_t kMaxShards = 32;
+      const size_t num_shards =
+          std::min(kMaxShards, ready->size() / kMinNodesPerShard);
+      if (sharded_dispatch_ && num_shards > 1) {
+        // Dispatch the ready nodes in shards: each task processes a strided
+        // slice of the ready list sequentially, so thread wakeups and queue
+        // operations scale with the shard count rather than the fan-out.
+        auto shared_ready = std::make_shared<TaggedNodeSeq>(std::move(*ready));
+        for (size_t shard = 0; shard < num_shards; ++shard) {
+          RunTask([this, shared_ready, shard, num_shards, scheduled_nsec]() {
+            for (size_t i = shard; i < shared_ready->size(); i += num_shards) {
+              Process((*shared_ready)[i], scheduled_nsec);
+            }
+          });
+        }
+      } else {
+        // Schedule to run all the ready ops in thread pool.
+        for (auto& tagged_node : *ready) {
+          RunTask([=]() { Process(tagged_node, scheduled_nsec); });
+        }
       }
     } else {
       for (auto& tagged_node : *ready) {
@@ -1200,6 +1293,15 @@ void ExecutorState<PropagatorStateType>::ScheduleReady(
           inline_ready->push_back(tagged_node);
         } else {
           if (curr_expensive_node) {
+            // Keep the latency-critical node for this thread (it runs
+            // soonest here) and dispatch the other one.
+            if (curr_expensive_node->node_item->is_scheduling_priority &&
+                !item.is_scheduling_priority) {
+              RunTask([this, tagged_node, scheduled_nsec]() {
+                Process(tagged_node, scheduled_nsec);
+              });
+              continue;
+            }
             // Dispatch to another thread since there is plenty of work to
             // do for this thread.
             RunTask(std::bind(&ExecutorState::Process, this,
@@ -116,6 +116,12 @@ class Executor {
     // If true, all kernels will be treated as "inexpensive", and hence executed
     // on the scheduling thread.
     bool run_all_kernels_inline = false;
+
+    // If true, ready nodes are dispatched to the inter-op thread pool in
+    // shards (one task per shard) rather than one task per node. This reduces
+    // thread wakeup overhead and scheduling contention for wide fan-out
+    // graphs. Ignored when `run_all_kernels_inline` is true.
+    bool enable_sharded_dispatch = false;
   };
   typedef std::function<void(const Status&)> DoneCallback;
   virtual void RunAsync(const Args& args, DoneCallback done) = 0;
@@ -32,6 +32,7 @@ limitations under the License.
 #include "tensorflow/core/common_runtime/step_stats_collector.h"
 #include "tensorflow/core/framework/attr_value.pb.h"
 #include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
 #include "tensorflow/core/framework/rendezvous.h"
 #include "tensorflow/core/framework/step_stats.pb.h"
 #include "tensorflow/core/framework/tensor_testutil.h"
@@ -40,6 +41,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/status_test_util.h"
 #include "tensorflow/core/lib/random/simple_philox.h"
 #include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/platform/test.h"
 #include "tensorflow/core/platform/test_benchmark.h"
@@ -91,9 +93,14 @@ class ExecutorTest : public ::testing::Test {
     args.rendezvous = rendez;
     args.stats_collector = &step_stats_collector_;
     args.runner = runner_;
+    args.enable_sharded_dispatch = enable_sharded_dispatch_;
     return exec_->Run(args);
   }
 
+  // When set before `Run`, ready nodes are dispatched to the thread pool in
+  // shards rather than one task per node.
+  bool enable_sharded_dispatch_ = false;
+
   thread::ThreadPool* thread_pool_ = nullptr;
   std::unique_ptr<Device> device_;
   Executor* exec_ = nullptr;
@@ -430,6 +437,135 @@ TEST_F(ExecutorTest, NoInputTensors) {
   TF_ASSERT_OK(Run(rendez_));
 }
 
+TEST_F(ExecutorTest, ShardedReadyDispatch) {
+  // A wide fan-out graph run with sharded ready-node dispatch: one input
+  // feeds 64 independent Add nodes whose results are summed back to one
+  // value. The fan-out is wide enough (> kMinNodesPerShard * 2) that the
+  // ready list is actually carved into multiple shards.
+  auto g = absl::make_unique<Graph>(OpRegistry::Global());
+  Node* in = test::graph::Recv(g.get(), "a", "float", ALICE, 1, BOB);
+  std::vector<Node*> layer;
+  layer.reserve(64);
+  for (int i = 0; i < 64; ++i) {
+    layer.push_back(test::graph::Add(g.get(), in, in));  // Each = 2 * in.
+  }
+  while (layer.size() > 1) {
+    std::vector<Node*> next_layer;
+    for (size_t i = 0; i < layer.size(); i += 2) {
+      next_layer.push_back(test::graph::Add(g.get(), layer[i], layer[i + 1]));
+    }
+    layer.swap(next_layer);
+  }
+  test::graph::Send(g.get(), layer[0], "c", BOB, 1, ALICE);
+  Create(std::move(g));
+  enable_sharded_dispatch_ = true;
+  Rendezvous::Args args;
+  TF_ASSERT_OK(
+      rendez_->Send(Key(ALICE, kIncarnation, BOB, "a"), args, V(1.0), false));
+  TF_ASSERT_OK(Run(rendez_));
+  Tensor out = V(-1);
+  bool is_dead = false;
+  TF_ASSERT_OK(
+      rendez_->Recv(Key(BOB, kIncarnation, ALICE, "c"), args, &out, &is_dead));
+  EXPECT_EQ(128.0, V(out));  // 64 adds of (1 + 1), summed.
+}
+
+TEST_F(ExecutorTest, LoopWithManyIterations) {
+  // Hand-built while loop: i = 0; while (i < n) i += one;  where `n` and
+  // `one` are loop-carried constants. Running 100 iterations creates and
+  // retires many IterationStates within a single step, so the per-step
+  // storage for frames and iterations is exercised through its full
+  // create/recycle/destroy cycle.
+  auto g = absl::make_unique<Graph>(OpRegistry::Global());
+  Node* i0 = test::graph::Recv(g.get(), "i", "int32", ALICE, 1, BOB);
+  Node* n0 = test::graph::Constant(g.get(), VI(100));
+  Node* one0 = test::graph::Constant(g.get(), VI(1));
+  Node* enter_i = test::graph::Enter(g.get(), i0, "loop");
+  Node* enter_n = test::graph::Enter(g.get(), n0, "loop");
+  Node* enter_one = test::graph::Enter(g.get(), one0, "loop");
+  // The second Merge input is a placeholder for the back edge, which is
+  // rewired to the corresponding NextIteration node below.
+  Node* merge_i = test::graph::Merge(g.get(), enter_i, enter_i);
+  Node* merge_n = test::graph::Merge(g.get(), enter_n, enter_n);
+  Node* merge_one = test::graph::Merge(g.get(), enter_one, enter_one);
+  Node* less = test::graph::Less(g.get(), merge_i, merge_n);
+  Node* cond = test::graph::LoopCond(g.get(), less);
+  Node* switch_i = test::graph::Switch(g.get(), merge_i, cond);
+  Node* switch_n = test::graph::Switch(g.get(), merge_n, cond);
+  Node* switch_one = test::graph::Switch(g.get(), merge_one, cond);
+  Node* body_i = test::graph::Identity(g.get(), switch_i, 1);
+  Node* body_n = test::graph::Identity(g.get(), switch_n, 1);
+  Node* body_one = test::graph::Identity(g.get(), switch_one, 1);
+  Node* add = test::graph::Add(g.get(), body_i, body_one);
+  Node* next_i = test::graph::Next(g.get(), "next_i", add);
+  Node* next_n = test::graph::Next(g.get(), "next_n", body_n);
+  Node* next_one = test::graph::Next(g.get(), "next_one", body_one);
+  TF_ASSERT_OK(g->UpdateEdge(next_i, 0, merge_i, 1));
+  TF_ASSERT_OK(g->UpdateEdge(next_n, 0, merge_n, 1));
+  TF_ASSERT_OK(g->UpdateEdge(next_one, 0, merge_one, 1));
+  Node* exit_i = test::graph::Exit(g.get(), switch_i);
+  test::graph::Send(g.get(), exit_i, "c", BOB, 1, ALICE);
+  Create(std::move(g));
+  Rendezvous::Args args;
+  TF_ASSERT_OK(
+      rendez_->Send(Key(ALICE, kIncarnation, BOB, "i"), args, VI(0), false));
+  TF_ASSERT_OK(Run(rendez_));
+  Tensor out = VI(-1);
+  bool is_dead = false;
+  TF_ASSERT_OK(
+      rendez_->Recv(Key(BOB, kIncarnation, ALICE, "c"), args, &out, &is_dead));
+  EXPECT_EQ(100, out.scalar<int32>()());
+  EXPECT_FALSE(is_dead);
+}
+
+REGISTER_OP("SlowCheapInc").Input("x: int64").Output("y: int64");
+
+// A kernel that claims to be inexpensive but runs long enough that the
+// executor's sampled cost estimator will reclassify it.
+class SlowCheapIncOp : public OpKernel {
+ public:
+  explicit SlowCheapIncOp(OpKernelConstruction* ctx) : OpKernel(ctx) {}
+  bool IsExpensive() override { return false; }
+  void Compute(OpKernelContext* ctx) override {
+    Env::Default()->SleepForMicroseconds(500);
+    Tensor* out = nullptr;
+    OP_REQUIRES_OK(ctx, ctx->allocate_output(0, TensorShape({}), &out));
+    out->scalar<int64_t>()() = ctx->input(0).scalar<int64_t>()() + 1;
+  }
+};
+REGISTER_KERNEL_BUILDER(Name("SlowCheapInc").Device(DEVICE_CPU),
+                        SlowCheapIncOp);
+
+TEST_F(ExecutorTest, AdaptiveExpensiveClassification) {
+  // A chain of nominally cheap kernels that each run for ~0.5ms. The cost
+  // estimator samples them and promotes them out of the inline class, so
+  // across repeated runs of the same executor, nodes migrate from the
+  // inline scheduling path to the thread pool. The chain result checks that
+  // every node still runs exactly once per step while that happens.
+  auto g = absl::make_unique<Graph>(OpRegistry::Global());
+  Node* node = test::graph::Recv(g.get(), "a", "int64", ALICE, 1, BOB);
+  for (int i = 0; i < 64; ++i) {
+    node = test::graph::Unary(g.get(), "SlowCheapInc", node);
+  }
+  test::graph::Send(g.get(), node, "b", BOB, 1, ALICE);
+  Create(std::move(g));
+  for (int run = 0; run < 3; ++run) {
+    Rendezvous* rendez = NewLocalRendezvous();
+    Rendezvous::Args args;
+    Tensor input(DT_INT64, TensorShape({}));
+    input.scalar<int64_t>()() = 0;
+    TF_ASSERT_OK(
+        rendez->Send(Key(ALICE, kIncarnation, BOB, "a"), args, input, false));
+    TF_ASSERT_OK(Run(rendez));
+    Tensor out(DT_INT64, TensorShape({}));
+    bool is_dead = false;
+    TF_ASSERT_OK(
+        rendez->Recv(Key(BOB, kIncarnation, ALICE, "b"), args, &out, &is_dead));
+    EXPECT_EQ(64, out.scalar<int64_t>()());
+    rendez->Unref();
+  }
+}
+
 // Create a graph that is 'depth' deep. At each level, fan-in and fan-out a
 // maximum of 'width' nodes. All nodes are no-ops and all dependencies are
 // control dependencies.
@@ -299,6 +299,31 @@ class BaseGPUDevice::StreamGroupFactory {
     return group;
   }
 
+  // Returns the stream group index a newly initialized device object for
+  // `tf_device_id` should use. With TF_GPU_STREAMS_PER_DEVICE=N (N > 1),
+  // successive device objects created for the same TF device - e.g. by
+  // different sessions hosting independent models on one physical GPU - are
+  // assigned stream groups round-robin over N groups, so their compute no
+  // longer serializes on a single stream. Defaults to group 0 for all
+  // devices, preserving the existing behavior.
+  int GetNextStreamGroupIndex(TfDeviceId tf_device_id) {
+    static const int64_t streams_per_device = [] {
+      int64_t value = 1;
+      Status status =
+          ReadInt64FromEnvVar("TF_GPU_STREAMS_PER_DEVICE", 1, &value);
+      if (!status.ok()) {
+        LOG(ERROR) << "GetNextStreamGroupIndex: " << status.error_message();
+      }
+      return std::max<int64_t>(1, value);
+    }();
+    if (streams_per_device <= 1) {
+      return 0;
+    }
+    mutex_lock guard(lock_);
+    return next_stream_group_index_[tf_device_id.value()]++ %
+           streams_per_device;
+  }
+
   // Returns a reference to the StreamGroupFactory singleton. Note that this is
   // never destroyed, so the objects it owns are never deleted.
   static StreamGroupFactory& Global() {
@@ -371,6 +396,8 @@ class BaseGPUDevice::StreamGroupFactory {
   }
 
   mutex lock_;
+  // Per-device round-robin counter for GetNextStreamGroupIndex.
+  std::map<int, int> next_stream_group_index_ TF_GUARDED_BY(lock_);
   using key_type = std::tuple<int, int>;
   std::map<key_type, StreamGroup> streams_;
 
@@ -440,7 +467,9 @@ Status BaseGPUDevice::Init(const SessionOptions& options) {
   executor_ = executor_status.ValueOrDie();
 
   stream_ = StreamGroupFactory::Global().GetOrCreate(
-      tf_device_id_, 0, executor_, options.config.gpu_options());
+      tf_device_id_,
+      StreamGroupFactory::Global().GetNextStreamGroupIndex(tf_device_id_),
+      executor_, options.config.gpu_options());
 
   // Get an allocator that allocates pinned memory on host.
   AllocatorAttributes attr;
@@ -260,6 +260,81 @@ bool NeedStaging(const Tensor* tensor) {
   return tensor->GetMemoryType() == AllocatorMemoryType::kHostPageable;
 }
 
+// Recycles pinned staging buffers by power-of-two size class, so repeated
+// feeds of the same shapes skip the pinned-allocator round-trip. Buffers are
+// returned to the pool from the EventMgr callback once the async copy has
+// retired, and are handed out again only for the allocator that created
+// them. Classes above kMaxCachedBytes (or a full class) fall through to the
+// allocator directly.
+class StagingBufferPool {
+ public:
+  static StagingBufferPool* Global() {
+    static StagingBufferPool* pool = new StagingBufferPool;
+    return pool;
+  }
+
+  // Returns a buffer of at least `bytes` (rounded to the class size, written
+  // to `*allocated_bytes`), or nullptr if the allocator fails.
+  void* Get(Allocator* allocator, size_t bytes, size_t* allocated_bytes) {
+    const int size_class = SizeClass(bytes);
+    // Oversized requests bypass the pool and keep their exact size.
+    *allocated_bytes = size_class < kNumClasses ? ClassBytes(size_class) : bytes;
+    if (size_class < kNumClasses) {
+      mutex_lock l(mu_);
+      std::vector<Entry>& entries = free_[size_class];
+      for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].allocator == allocator) {
+          void* ptr = entries[i].ptr;
+          entries[i] = entries.back();
+          entries.pop_back();
+          return ptr;
+        }
+      }
+    }
+    return allocator->AllocateRaw(Allocator::kAllocatorAlignment,
+                                  *allocated_bytes);
+  }
+
+  // Returns a buffer obtained from Get.
+  void Release(Allocator* allocator, void* ptr, size_t allocated_bytes) {
+    const int size_class = SizeClass(allocated_bytes);
+    if (size_class < kNumClasses) {
+      mutex_lock l(mu_);
+      std::vector<Entry>& entries = free_[size_class];
+      if (entries.size() < kMaxCachedPerClass) {
+        entries.push_back({allocator, ptr});
+        return;
+      }
+    }
+    allocator->DeallocateRaw(ptr);
+  }
+
+ private:
+  static constexpr size_t kMinClassBytes = 4096;
+  static constexpr int kNumClasses = 13;  // 4KB .. 16MB
+  static constexpr size_t kMaxCachedPerClass = 8;
+
+  struct Entry {
+    Allocator* allocator;
+    void* ptr;
+  };
+
+  static size_t ClassBytes(int size_class) {
+    return kMinClassBytes << size_class;
+  }
+
+  static int SizeClass(size_t bytes) {
+    int size_class = 0;
+    while (size_class < kNumClasses && ClassBytes(size_class) < bytes) {
+      ++size_class;
+    }
+    return size_class;
+  }
+
+  mutex mu_;
+  std::vector<Entry> free_[kNumClasses] TF_GUARDED_BY(mu_);
+};
+
 }  // namespace
 
 // static
@@ -288,20 +363,48 @@ void GPUUtil::CopyGPUTensorToCPU(Device* gpu_device,
   send_device_to_host_stream->ThenWaitFor(send_stream);
 
   const int64_t total_bytes = gpu_tensor->TotalBytes();
+  // Small device-to-host reads (condition predicates, loop counters, shape
+  // scalars) whose destination is pageable memory otherwise force the
+  // driver's slow synchronous path. Stage them through the recycled pinned
+  // pool: the async copy lands in pinned memory and the tiny payload is
+  // memcpy'd to the destination when the stream reaches it.
+  constexpr int64_t kMaxPinnedPeekBytes = 4096;
+  void* peek_buffer = nullptr;
+  size_t peek_buffer_bytes = 0;
+  Allocator* peek_allocator = nullptr;
   if (total_bytes > 0) {
     void* src_ptr = GetBase(gpu_tensor);
     DeviceMemoryBase gpu_src_ptr(src_ptr, total_bytes);
     void* dst_ptr = GetBase(cpu_tensor);
-    send_device_to_host_stream->ThenMemcpy(dst_ptr, gpu_src_ptr, total_bytes);
+    if (total_bytes <= kMaxPinnedPeekBytes &&
+        cpu_tensor->GetMemoryType() == AllocatorMemoryType::kHostPageable) {
+      peek_allocator = device_context->host_memory_allocator();
+    }
+    if (peek_allocator != nullptr) {
+      peek_buffer = StagingBufferPool::Global()->Get(
+          peek_allocator, total_bytes, &peek_buffer_bytes);
+      send_device_to_host_stream->ThenMemcpy(peek_buffer, gpu_src_ptr,
+                                             total_bytes);
+    } else {
+      send_device_to_host_stream->ThenMemcpy(dst_ptr, gpu_src_ptr,
+                                             total_bytes);
+    }
   }
   // Use of the input may outlive stack scope, so keep a ref.
   TensorReference input_ref(*gpu_tensor);
+  void* dst_base = total_bytes > 0 ? GetBase(cpu_tensor) : nullptr;
   dev_info->event_mgr->ThenExecute(
       send_device_to_host_stream,
-      [send_device_to_host_stream, done, input_ref]() {
+      [send_device_to_host_stream, done, input_ref, peek_buffer,
+       peek_buffer_bytes, peek_allocator, dst_base, total_bytes]() {
         if (!send_device_to_host_stream->ok()) {
           LOG(FATAL) << "GPU->CPU Memcpy failed";
         }
+        if (peek_buffer != nullptr) {
+          std::memcpy(dst_base, peek_buffer, total_bytes);
+          StagingBufferPool::Global()->Release(peek_allocator, peek_buffer,
+                                               peek_buffer_bytes);
+        }
         input_ref.Unref();
         done(Status::OK());
       });
@@ -338,6 +441,7 @@ void GPUUtil::CopyCPUTensorToGPU(const Tensor* cpu_tensor,
 
   bool do_staging = false;
   void* staging_buffer = nullptr;
+  size_t staging_buffer_bytes = 0;
   Allocator* host_memory_allocator = device_context->host_memory_allocator();
 
   // Use of cpu_tensor may outlive stack scope, so keep a ref.
@@ -360,8 +464,8 @@ void GPUUtil::CopyCPUTensorToGPU(const Tensor* cpu_tensor,
     }
 
     if (do_staging) {
-      staging_buffer = host_memory_allocator->AllocateRaw(
-          tensorflow::Allocator::kAllocatorAlignment, total_bytes);
+      staging_buffer = StagingBufferPool::Global()->Get(
+          host_memory_allocator, total_bytes, &staging_buffer_bytes);
       std::memcpy(staging_buffer, src_ptr, total_bytes);
       input_ref.Unref();
 
@@ -376,9 +480,10 @@ void GPUUtil::CopyCPUTensorToGPU(const Tensor* cpu_tensor,
   dev_info->event_mgr->ThenExecute(
       recv_host_to_device_stream,
       [recv_host_to_device_stream, done, input_ref, do_staging, staging_buffer,
-       host_memory_allocator]() {
+       staging_buffer_bytes, host_memory_allocator]() {
         if (do_staging) {
-          host_memory_allocator->DeallocateRaw(staging_buffer);
+          StagingBufferPool::Global()->Release(
+              host_memory_allocator, staging_buffer, staging_buffer_bytes);
         } else {
           input_ref.Unref();
         }
@@ -22,6 +22,7 @@ limitations under the License.
 #include <utility>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/flat_hash_set.h"
 #include "absl/memory/memory.h"
 #include "absl/strings/str_join.h"
@@ -49,7 +50,10 @@ limitations under the License.
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/gtl/flatset.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
 #include "tensorflow/core/lib/strings/stringprintf.h"
+#include "tensorflow/core/platform/env.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/util/device_name_utils.h"
@@ -606,6 +610,86 @@ Status GraphExecutionState::PruneGraph(
   return Status::OK();
 }
 
+namespace {
+
+// Cached device placements: when TF_PLACEMENT_CACHE_DIR is set, the device
+// assignment computed by the Placer is written to that directory keyed by a
+// fingerprint of the (pre-placement) graph and the device set, and reapplied
+// on subsequent initializations of the same graph on the same device
+// configuration. This skips the placement constraint solving that dominates
+// session cold start for large graphs. The artifact is a stripped GraphDef
+// holding only node names and assigned devices.
+
+string PlacementCacheDir() {
+  const char* dir = getenv("TF_PLACEMENT_CACHE_DIR");
+  return dir == nullptr ? string() : string(dir);
+}
+
+// Returns the cache-artifact path for `graph` placed on `device_set`, or an
+// empty string if the cache is disabled.
+string PlacementCachePath(const Graph& graph, const DeviceSet* device_set) {
+  const string dir = PlacementCacheDir();
+  if (dir.empty()) return string();
+  GraphDef gdef;
+  graph.ToGraphDef(&gdef);
+  string serialized;
+  if (!SerializeToStringDeterministic(gdef, &serialized)) return string();
+  uint64 fp = Fingerprint64(serialized);
+  for (const Device* d : device_set->devices()) {
+    fp = FingerprintCat64(fp, Fingerprint64(d->name()));
+  }
+  return strings::Printf("%s/placement_%016llx.pb", dir.c_str(),
+                         static_cast<unsigned long long>(fp));
+}
+
+// Applies a cached placement to `graph`. Returns false (leaving the graph's
+// assignments untouched on any node it had not yet visited) if the artifact
+// is missing, stale, or references unknown devices; the caller then falls
+// back to running the Placer.
+bool TryApplyCachedPlacement(const string& path, const DeviceSet* device_set,
+                             Graph* graph) {
+  GraphDef placement;
+  if (!ReadBinaryProto(Env::Default(), path, &placement).ok()) return false;
+  absl::flat_hash_map<string, const NodeDef*> assignments;
+  assignments.reserve(placement.node_size());
+  for (const NodeDef& node : placement.node()) {
+    assignments.emplace(node.name(), &node);
+  }
+  for (Node* node : graph->op_nodes()) {
+    auto it = assignments.find(node->name());
+    if (it == assignments.end()) return false;
+    if (device_set->FindDeviceByName(it->second->device()) == nullptr) {
+      return false;
+    }
+  }
+  for (Node* node : graph->op_nodes()) {
+    node->set_assigned_device_name(assignments[node->name()]->device());
+  }
+  return true;
+}
+
+// Best-effort write of the placement artifact; failures only cost the next
+// startup a fresh placement run.
+void SaveCachedPlacement(const string& path, const Graph& graph) {
+  GraphDef placement;
+  for (const Node* node : graph.op_nodes()) {
+    NodeDef* ndef = placement.add_node();
+    ndef->set_name(node->name());
+    ndef->set_device(node->assigned_device_name());
+  }
+  const string tmp_path = strings::StrCat(path, ".tmp");
+  Status status = WriteBinaryProto(Env::Default(), tmp_path, placement);
+  if (status.ok()) {
+    status = Env::Default()->RenameFile(tmp_path, path);
+  }
+  if (!status.ok()) {
+    LOG(WARNING) << "Failed to write placement cache artifact " << path << ": "
+                 << status.error_message();
+  }
+}
+
+}  // namespace
+
 Status GraphExecutionState::InitBaseGraph(std::unique_ptr<Graph>&& new_graph) {
   // Save stateful placements before placing.
   RestoreStatefulNodes(new_graph.get());
@@ -620,14 +704,25 @@ Status GraphExecutionState::InitBaseGraph(std::unique_ptr<Graph>&& new_graph) {
   TF_RETURN_IF_ERROR(OptimizationPassRegistry::Global()->RunGrouping(
       OptimizationPassRegistry::PRE_PLACEMENT, optimization_options));
 
-  Placer placer(new_graph.get(), "", flib_def_.get(), device_set_,
-                /* default_local_device= */ nullptr,
-                session_options_ == nullptr ||
-                    session_options_->config.allow_soft_placement(),
-                session_options_ != nullptr &&
-                    session_options_->config.log_device_placement());
-  // TODO(mrry): Consider making the Placer cancellable.
-  TF_RETURN_IF_ERROR(placer.Run());
+  const string placement_cache_path =
+      PlacementCachePath(*new_graph, device_set_);
+  if (!placement_cache_path.empty() &&
+      TryApplyCachedPlacement(placement_cache_path, device_set_,
+                              new_graph.get())) {
+    VLOG(1) << "Applied cached placement from " << placement_cache_path;
+  } else {
+    Placer placer(new_graph.get(), "", flib_def_.get(), device_set_,
+                  /* default_local_device= */ nullptr,
+                  session_options_ == nullptr ||
+                      session_options_->config.allow_soft_placement(),
+                  session_options_ != nullptr &&
+                      session_options_->config.log_device_placement());
+    // TODO(mrry): Consider making the Placer cancellable.
+    TF_RETURN_IF_ERROR(placer.Run());
+    if (!placement_cache_path.empty()) {
+      SaveCachedPlacement(placement_cache_path, *new_graph);
+    }
+  }
 
   TF_RETURN_IF_ERROR(OptimizationPassRegistry::Global()->RunGrouping(
       OptimizationPassRegistry::POST_PLACEMENT, optimization_options));
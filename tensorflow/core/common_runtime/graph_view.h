@@ -85,6 +85,9 @@ struct NodeItem {
                                     // node's input types.
   bool is_distributed_communication : 1;  // True iff the op is registered to
                                           // use distributed communication.
+  bool is_scheduling_priority : 1;        // True iff the node carries the
+                                          // "_scheduling_priority" attr > 0,
+                                          // marking it latency-critical.
 
   // The kernel for this node.
   OpKernel* kernel = nullptr;
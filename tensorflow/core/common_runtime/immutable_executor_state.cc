@@ -196,15 +196,16 @@ Status ImmutableExecutorState::Initialize(const Graph& graph) {
     item->is_recv_or_switch = IsRecv(n) || IsSwitch(n);
     item->is_next_iteration = IsNextIteration(n);
     item->is_distributed_communication = IsDistributedCommunication(n);
-
-    // Compute the maximum values we'll store for this node in the
-    // pending counts data structure, and allocate a handle in
-    // that frame's pending counts data structure that has enough
-    // space to store these maximal count values.
-    size_t max_pending, max_dead;
-    GetMaxPendingCounts(n, &max_pending, &max_dead);
-    pending_ids_[id] =
-        frame_info->pending_counts_layout.CreateHandle(max_pending, max_dead);
+    {
+      // Latency-critical marking: graphs may annotate nodes on the critical
+      // path with "_scheduling_priority" (any value > 0); the executor's
+      // dispatch uses it as a tie-breaker.
+      int64_t scheduling_priority = 0;
+      item->is_scheduling_priority =
+          GetNodeAttr(n->attrs(), "_scheduling_priority", &scheduling_priority)
+              .ok() &&
+          scheduling_priority > 0;
+    }
 
     // See if this node is a root node, and if so, add item to root_nodes_.
     if (n->in_edges().empty()) {
@@ -256,6 +257,39 @@ Status ImmutableExecutorState::Initialize(const Graph& graph) {
     }
   }
 
+  // Allocate the PendingCounts handles in an activation-locality-aware
+  // order: the successors of a node are activated together during
+  // PropagateOutputs, so nodes that share a (lowest-id) predecessor get
+  // adjacent byte offsets in their frame's PendingCounts block. This packs
+  // the counters touched by one propagation pass into as few cache lines as
+  // possible; large graphs otherwise stall on scattered counter loads.
+  {
+    std::vector<int> handle_order;
+    handle_order.reserve(gview_.num_nodes());
+    std::vector<int> group_key(gview_.num_nodes(), 0);
+    for (const Node* n : graph.nodes()) {
+      if (IsSink(n)) continue;
+      int key = n->id();
+      for (const Edge* e : n->in_edges()) {
+        key = std::min(key, e->src()->id());
+      }
+      group_key[n->id()] = key;
+      handle_order.push_back(n->id());
+    }
+    std::stable_sort(handle_order.begin(), handle_order.end(),
+                     [&group_key](int a, int b) {
+                       return group_key[a] < group_key[b];
+                     });
+    for (const int id : handle_order) {
+      const Node* n = graph.FindNodeId(id);
+      size_t max_pending, max_dead;
+      GetMaxPendingCounts(n, &max_pending, &max_dead);
+      FrameInfo* frame_info = EnsureFrameInfo(cf_info.frame_names[id]);
+      pending_ids_[id] = frame_info->pending_counts_layout.CreateHandle(
+          max_pending, max_dead);
+    }
+  }
+
   // Initialize PendingCounts only after pending_ids_[node.id] is initialized
   // for all nodes.
   InitializePending(&graph, cf_info);
@@ -0,0 +1,150 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cstdlib>
+#include <cstring>
+
+#include "absl/container/flat_hash_set.h"
+#include "tensorflow/core/common_runtime/optimization_registry.h"
+#include "tensorflow/core/framework/node_def_util.h"
+#include "tensorflow/core/graph/graph.h"
+#include "tensorflow/core/util/util.h"
+
+namespace tensorflow {
+namespace {
+
+// Annotates chains of same-shape elementwise ops with the "_forward_input"
+// attr, which the executor's NodeItem setup turns into an unconditional
+// buffer reservation (see forward_from in graph_view.cc): the kernel's
+// output 0 reuses its input 0 buffer without the per-call refcount probe in
+// forward_input(). Enabled by TF_ENABLE_STATIC_FORWARDING=1.
+//
+// The reservation skips the runtime uniqueness check, so it is only placed
+// where exclusive buffer ownership is statically guaranteed:
+//
+//  - The consumer is a shape-preserving unary elementwise op (so the
+//    output shape always equals the input shape).
+//  - The consumed value is that output's only data consumer.
+//  - The producer is itself an elementwise compute op on the same device.
+//    Such ops either allocate a fresh output or runtime-forward an input
+//    whose refcount was one, so their output buffer is exclusively owned by
+//    the executor's entry; ops that alias long-lived buffers (Identity,
+//    Const, variable reads, transfers, control flow) never qualify.
+//  - Neither node already carries forwarding or scoped-allocator attrs.
+//
+// The pass runs at POST_REWRITE_FOR_EXEC, after feed/fetch rewriting and
+// pruning, because the checks above are only meaningful on the final
+// execution graph: on the base graph a fetched intermediate has no _Retval
+// or _Send consumer yet (so a "single consumer" there can gain one), a fed
+// tensor's validated producer gets replaced by _Recv/_Arg, and constant
+// folding can turn a producer into a Const whose persistent buffer must
+// never be overwritten.
+class InplaceChainPass : public GraphOptimizationPass {
+ public:
+  Status Run(const GraphOptimizationPassOptions& options) override {
+    if (!IsEnabled()) return Status::OK();
+    // The oneDNN layout rewrite clones node attrs onto _Mkl* replacement
+    // nodes whose input/output arity differs, which would misapply a 0->0
+    // reservation placed here. Do not annotate graphs that may be rewritten
+    // by it.
+    if (IsMKLEnabled()) return Status::OK();
+    if (options.graph == nullptr) return Status::OK();
+    Graph* g = options.graph->get();
+    if (g == nullptr) {
+      return errors::Internal(
+          "In-place chain optimization should happen before partitioning and "
+          "a graph should be available.");
+    }
+
+    for (Node* n : g->op_nodes()) {
+      if (!IsShapePreservingUnary(n->type_string())) continue;
+      if (HasNodeAttr(n->def(), "_forward_input") ||
+          HasNodeAttr(n->def(), "_scoped_allocator")) {
+        continue;
+      }
+
+      const Edge* in_edge = nullptr;
+      for (const Edge* e : n->in_edges()) {
+        if (!e->IsControlEdge()) {
+          if (in_edge != nullptr) {
+            in_edge = nullptr;
+            break;
+          }
+          in_edge = e;
+        }
+      }
+      if (in_edge == nullptr || in_edge->dst_input() != 0) continue;
+
+      Node* src = in_edge->src();
+      if (!IsElementwiseProducer(src->type_string())) continue;
+      if (HasNodeAttr(src->def(), "_scoped_allocator")) continue;
+      if (src->assigned_device_name() != n->assigned_device_name()) continue;
+      if (IsRefType(src->output_type(in_edge->src_output()))) continue;
+
+      // The forwarded value must have no other data consumer.
+      int output_consumers = 0;
+      for (const Edge* e : src->out_edges()) {
+        if (!e->IsControlEdge() && e->src_output() == in_edge->src_output()) {
+          ++output_consumers;
+        }
+      }
+      if (output_consumers != 1) continue;
+
+      // Reserve input 0 for output 0.
+      n->AddAttr("_forward_input", std::vector<int>{0, 0});
+    }
+    return Status::OK();
+  }
+
+ private:
+  static bool IsEnabled() {
+    // Deliberately not latched: the pass runs once per graph, and tests
+    // toggle the environment variable between graphs.
+    const char* value = getenv("TF_ENABLE_STATIC_FORWARDING");
+    return value != nullptr && strcmp(value, "1") == 0;
+  }
+
+  // Unary elementwise ops whose output shape and dtype always equal their
+  // input's, making an unconditional in-place reservation shape-safe.
+  static bool IsShapePreservingUnary(const string& op) {
+    static const auto* const kOps = new absl::flat_hash_set<string>({
+        "Abs",      "Ceil",       "Elu",      "Exp",     "Floor",
+        "LeakyRelu", "Log",       "Log1p",    "Neg",     "Reciprocal",
+        "Relu",     "Relu6",      "Round",    "Rsqrt",   "Selu",
+        "Sigmoid",  "Sign",       "Softplus", "Softsign", "Sqrt",
+        "Square",   "Tanh",
+    });
+    return kOps->contains(op);
+  }
+
+  // Elementwise compute ops that always hand the executor an exclusively
+  // owned output buffer (freshly allocated, or runtime-forwarded from a
+  // uniquely owned input).
+  static bool IsElementwiseProducer(const string& op) {
+    static const auto* const kOps = new absl::flat_hash_set<string>({
+        "Add",      "AddV2",   "Div",     "Maximum", "Minimum",
+        "Mul",      "RealDiv", "SquaredDifference",   "Sub",
+    });
+    return kOps->contains(op) || IsShapePreservingUnary(op);
+  }
+};
+
+// Phase 25: after the auto-clustering support passes at 20 and below, before
+// PartiallyDeclusterPass at 30; no other pass shares this phase.
+REGISTER_OPTIMIZATION(OptimizationPassRegistry::POST_REWRITE_FOR_EXEC, 25,
+                      InplaceChainPass);
+
+}  // namespace
+}  // namespace tensorflow
@@ -0,0 +1,252 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cstdlib>
+
+#include "tensorflow/core/common_runtime/direct_session.h"
+#include "tensorflow/core/common_runtime/optimization_registry.h"
+#include "tensorflow/core/framework/node_def_util.h"
+#include "tensorflow/core/framework/tensor_testutil.h"
+#include "tensorflow/core/graph/graph.h"
+#include "tensorflow/core/graph/node_builder.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/test.h"
+#include "tensorflow/core/public/session.h"
+#include "tensorflow/core/util/util.h"
+
+namespace tensorflow {
+namespace {
+
+constexpr char kDevice[] = "/job:localhost/replica:0/task:0/device:CPU:0";
+
+// Runs the POST_REWRITE_FOR_EXEC grouping (which includes InplaceChainPass)
+// over `graph` with all nodes assigned to the local CPU device. The callers
+// below hand it graphs in post-rewrite form, i.e. with feeds and fetches
+// already materialized as _Arg/_Retval nodes where relevant.
+Status RunPostRewritePasses(std::unique_ptr<Graph>* graph) {
+  for (Node* n : (*graph)->op_nodes()) {
+    n->set_assigned_device_name(kDevice);
+  }
+  GraphOptimizationPassOptions options;
+  options.graph = graph;
+  FunctionLibraryDefinition flib_def((*graph)->flib_def());
+  options.flib_def = &flib_def;
+  return OptimizationPassRegistry::Global()->RunGrouping(
+      OptimizationPassRegistry::POST_REWRITE_FOR_EXEC, options);
+}
+
+Node* Placeholder(Graph* g, const string& name) {
+  Node* node;
+  TF_CHECK_OK(NodeBuilder(name, "Placeholder")
+                  .Attr("dtype", DT_FLOAT)
+                  .Attr("shape", TensorShape({2}))
+                  .Finalize(g, &node));
+  return node;
+}
+
+Node* Binary(Graph* g, const string& op, const string& name, Node* a, Node* b) {
+  Node* node;
+  TF_CHECK_OK(NodeBuilder(name, op).Input(a).Input(b).Finalize(g, &node));
+  return node;
+}
+
+Node* Unary(Graph* g, const string& op, const string& name, Node* in) {
+  Node* node;
+  TF_CHECK_OK(NodeBuilder(name, op).Input(in).Finalize(g, &node));
+  return node;
+}
+
+Node* FindNode(const Graph& g, const string& name) {
+  for (Node* n : g.nodes()) {
+    if (n->name() == name) return n;
+  }
+  return nullptr;
+}
+
+class InplaceChainOptimizerTest : public ::testing::Test {
+ protected:
+  void SetUp() override { setenv("TF_ENABLE_STATIC_FORWARDING", "1", 1); }
+  void TearDown() override { unsetenv("TF_ENABLE_STATIC_FORWARDING"); }
+};
+
+TEST_F(InplaceChainOptimizerTest, AnnotatesUnaryAfterElementwiseProducer) {
+  if (IsMKLEnabled()) GTEST_SKIP() << "Pass is disabled under oneDNN.";
+  auto graph = absl::make_unique<Graph>(OpRegistry::Global());
+  Node* a = Placeholder(graph.get(), "a");
+  Node* b = Placeholder(graph.get(), "b");
+  Node* add = Binary(graph.get(), "AddV2", "add", a, b);
+  Unary(graph.get(), "Relu", "relu", add);
+
+  TF_ASSERT_OK(RunPostRewritePasses(&graph));
+
+  Node* relu = FindNode(*graph, "relu");
+  ASSERT_NE(relu, nullptr);
+  std::vector<int32> forward_input;
+  TF_ASSERT_OK(GetNodeAttr(relu->attrs(), "_forward_input", &forward_input));
+  EXPECT_EQ(forward_input, std::vector<int32>({0, 0}));
+  // The binary consumer itself must not be annotated.
+  Node* add_node = FindNode(*graph, "add");
+  ASSERT_NE(add_node, nullptr);
+  EXPECT_FALSE(HasNodeAttr(add_node->def(), "_forward_input"));
+}
+
+TEST_F(InplaceChainOptimizerTest, SkipsMultiConsumerValues) {
+  if (IsMKLEnabled()) GTEST_SKIP() << "Pass is disabled under oneDNN.";
+  auto graph = absl::make_unique<Graph>(OpRegistry::Global());
+  Node* a = Placeholder(graph.get(), "a");
+  Node* b = Placeholder(graph.get(), "b");
+  Node* add = Binary(graph.get(), "AddV2", "add", a, b);
+  Unary(graph.get(), "Relu", "relu", add);
+  Unary(graph.get(), "Neg", "neg", add);  // Second consumer of add.
+
+  TF_ASSERT_OK(RunPostRewritePasses(&graph));
+
+  for (const char* name : {"relu", "neg"}) {
+    Node* n = FindNode(*graph, name);
+    ASSERT_NE(n, nullptr);
+    EXPECT_FALSE(HasNodeAttr(n->def(), "_forward_input")) << name;
+  }
+}
+
+TEST_F(InplaceChainOptimizerTest, SkipsNonElementwiseProducers) {
+  if (IsMKLEnabled()) GTEST_SKIP() << "Pass is disabled under oneDNN.";
+  auto graph = absl::make_unique<Graph>(OpRegistry::Global());
+  // Placeholder is not an exclusively-owned-output producer; its buffer is
+  // the fed tensor.
+  Node* a = Placeholder(graph.get(), "a");
+  Unary(graph.get(), "Relu", "relu", a);
+
+  TF_ASSERT_OK(RunPostRewritePasses(&graph));
+
+  Node* relu = FindNode(*graph, "relu");
+  ASSERT_NE(relu, nullptr);
+  EXPECT_FALSE(HasNodeAttr(relu->def(), "_forward_input"));
+}
+
+TEST_F(InplaceChainOptimizerTest, SkipsValuesConsumedByRetval) {
+  if (IsMKLEnabled()) GTEST_SKIP() << "Pass is disabled under oneDNN.";
+  auto graph = absl::make_unique<Graph>(OpRegistry::Global());
+  // Post-rewrite form of fetching the intermediate "add": the fetch is a
+  // _Retval consumer, so the value feeding relu is no longer single-consumer
+  // and must not be reserved for in-place overwrite.
+  Node* a = Placeholder(graph.get(), "a");
+  Node* b = Placeholder(graph.get(), "b");
+  Node* add = Binary(graph.get(), "AddV2", "add", a, b);
+  Unary(graph.get(), "Relu", "relu", add);
+  Node* retval;
+  TF_ASSERT_OK(NodeBuilder("retval", "_Retval")
+                   .Input(add)
+                   .Attr("T", DT_FLOAT)
+                   .Attr("index", 0)
+                   .Finalize(graph.get(), &retval));
+
+  TF_ASSERT_OK(RunPostRewritePasses(&graph));
+
+  Node* relu = FindNode(*graph, "relu");
+  ASSERT_NE(relu, nullptr);
+  EXPECT_FALSE(HasNodeAttr(relu->def(), "_forward_input"));
+}
+
+TEST_F(InplaceChainOptimizerTest, SkipsFedProducers) {
+  if (IsMKLEnabled()) GTEST_SKIP() << "Pass is disabled under oneDNN.";
+  auto graph = absl::make_unique<Graph>(OpRegistry::Global());
+  // Post-rewrite form of feeding relu's input: the producer is an _Arg whose
+  // buffer belongs to the caller, so relu must not overwrite it in place.
+  Node* arg;
+  TF_ASSERT_OK(NodeBuilder("arg", "_Arg")
+                   .Attr("T", DT_FLOAT)
+                   .Attr("index", 0)
+                   .Finalize(graph.get(), &arg));
+  Unary(graph.get(), "Relu", "relu", arg);
+
+  TF_ASSERT_OK(RunPostRewritePasses(&graph));
+
+  Node* relu = FindNode(*graph, "relu");
+  ASSERT_NE(relu, nullptr);
+  EXPECT_FALSE(HasNodeAttr(relu->def(), "_forward_input"));
+}
+
+TEST_F(InplaceChainOptimizerTest, DisabledWithoutEnvVar) {
+  unsetenv("TF_ENABLE_STATIC_FORWARDING");
+  auto graph = absl::make_unique<Graph>(OpRegistry::Global());
+  Node* a = Placeholder(graph.get(), "a");
+  Node* b = Placeholder(graph.get(), "b");
+  Node* add = Binary(graph.get(), "AddV2", "add", a, b);
+  Unary(graph.get(), "Relu", "relu", add);
+
+  TF_ASSERT_OK(RunPostRewritePasses(&graph));
+
+  Node* relu = FindNode(*graph, "relu");
+  ASSERT_NE(relu, nullptr);
+  EXPECT_FALSE(HasNodeAttr(relu->def(), "_forward_input"));
+}
+
+// End-to-end: an annotated chain must produce the same values as the
+// unannotated graph. This executes the forward_expected reservation in
+// forward_input(), i.e. the path that skips the refcount probe.
+TEST_F(InplaceChainOptimizerTest, AnnotatedChainComputesCorrectValues) {
+  if (IsMKLEnabled()) GTEST_SKIP() << "Pass is disabled under oneDNN.";
+  GraphDef graph_def;
+  {
+    Graph graph(OpRegistry::Global());
+    Node* a = Placeholder(&graph, "a");
+    Node* b = Placeholder(&graph, "b");
+    Node* add = Binary(&graph, "AddV2", "add", a, b);
+    Node* relu = Unary(&graph, "Relu", "relu", add);
+    Unary(&graph, "Sqrt", "sqrt", relu);
+    graph.ToGraphDef(&graph_def);
+  }
+
+  SessionOptions options;
+  std::unique_ptr<Session> session(NewSession(options));
+  TF_ASSERT_OK(session->Create(graph_def));
+
+  Tensor a = test::AsTensor<float>({3.0f, -8.0f});
+  Tensor b = test::AsTensor<float>({1.0f, 4.0f});
+  std::vector<Tensor> outputs;
+  TF_ASSERT_OK(
+      session->Run({{"a", a}, {"b", b}}, {"sqrt"}, {}, &outputs));
+  ASSERT_EQ(outputs.size(), 1);
+  // sqrt(relu(a + b)) = sqrt(max(a + b, 0)) = {2, 0}.
+  test::ExpectTensorNear<float>(outputs[0],
+                                test::AsTensor<float>({2.0f, 0.0f}), 1e-6);
+
+  // Fetching the intermediate alongside the chain output must return the
+  // un-overwritten intermediate: the fetch adds a _Send/_Retval consumer in
+  // the rewritten graph, which disqualifies the in-place reservation.
+  outputs.clear();
+  TF_ASSERT_OK(
+      session->Run({{"a", a}, {"b", b}}, {"add", "sqrt"}, {}, &outputs));
+  ASSERT_EQ(outputs.size(), 2);
+  test::ExpectTensorNear<float>(outputs[0],
+                                test::AsTensor<float>({4.0f, -4.0f}), 1e-6);
+  test::ExpectTensorNear<float>(outputs[1],
+                                test::AsTensor<float>({2.0f, 0.0f}), 1e-6);
+
+  // Feeding the intermediate must leave the caller's tensor untouched: the
+  // feed replaces the validated producer, so the chain may not scribble on
+  // the fed buffer.
+  Tensor fed = test::AsTensor<float>({9.0f, -1.0f});
+  outputs.clear();
+  TF_ASSERT_OK(session->Run({{"add", fed}}, {"sqrt"}, {}, &outputs));
+  ASSERT_EQ(outputs.size(), 1);
+  test::ExpectTensorNear<float>(outputs[0],
+                                test::AsTensor<float>({3.0f, 0.0f}), 1e-6);
+  test::ExpectTensorNear<float>(fed, test::AsTensor<float>({9.0f, -1.0f}),
+                                0.0);
+}
+
+}  // namespace
+}  // namespace tensorflow
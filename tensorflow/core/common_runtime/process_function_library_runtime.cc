@@ -1368,8 +1368,43 @@ void ProcessFunctionLibraryRuntime::RunMultiDeviceAsync(
     refcounted_done->Ref();
   }
 
+  // Resolve every component's arguments up front, in parallel when a thread
+  // pool is available: argument packing may block on remote handle
+  // resolution, and resolving N shards serially puts N round-trips on the
+  // dispatch critical path. Parallelizing is only safe when the dispatching
+  // thread is not itself a `default_thread_pool_` thread: a pool thread
+  // blocking on the counter would wait on tasks queued behind other blocked
+  // dispatchers, which deadlocks once concurrent dispatches reach the pool
+  // size (nested multi-device calls run their dispatch on this very pool).
+  std::vector<const ComponentFunctionData*> comp_datas;
+  comp_datas.reserve(data->glue_.size());
+  for (const auto& pair : data->glue_) {
+    comp_datas.push_back(&pair.second);
+  }
+  std::vector<InternalArgs> all_comp_args(comp_datas.size());
+  std::vector<Status> arg_statuses(comp_datas.size());
+  if (default_thread_pool_ != nullptr && comp_datas.size() > 1 &&
+      default_thread_pool_->CurrentThreadId() == -1) {
+    BlockingCounter counter(static_cast<int>(comp_datas.size()));
+    for (size_t i = 0; i < comp_datas.size(); ++i) {
+      default_thread_pool_->Schedule(
+          [&, i]() {
+            arg_statuses[i] =
+                get_component_args(*comp_datas[i], &all_comp_args[i]);
+            counter.DecrementCount();
+          });
+    }
+    counter.Wait();
+  } else {
+    for (size_t i = 0; i < comp_datas.size(); ++i) {
+      arg_statuses[i] = get_component_args(*comp_datas[i], &all_comp_args[i]);
+    }
+  }
+
   FunctionLibraryRuntime::Options opts_copy = opts;
+  int comp_index = -1;
   for (const auto& pair : data->glue_) {
+    ++comp_index;
     const string& target = pair.first;
     const ComponentFunctionData& comp_data = pair.second;
     FunctionLibraryRuntime::Handle comp_handle = pair.second.handle;
@@ -1378,8 +1413,8 @@ void ProcessFunctionLibraryRuntime::RunMultiDeviceAsync(
     opts_copy.rets_alloc_attrs = comp_data.ret_alloc_attrs;
     opts_copy.cancellation_manager = cm;
 
-    InternalArgs comp_args;
-    Status s = get_component_args(comp_data, &comp_args);
+    InternalArgs& comp_args = all_comp_args[comp_index];
+    const Status& s = arg_statuses[comp_index];
     if (!s.ok()) {
       VLOG(2) << "Failed to get component function arguments: " << s;
       refcounted_done->UpdateStatus(s);
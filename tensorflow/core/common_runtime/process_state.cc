@@ -28,6 +28,7 @@ limitations under the License.
 #include "tensorflow/core/lib/strings/strcat.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/numa.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/util/env_var.h"
 
@@ -44,7 +45,20 @@ namespace tensorflow {
 }
 
 ProcessState::ProcessState()
-    : numa_enabled_(false), cpu_allocators_cached_(0) {}
+    : numa_enabled_(false), cpu_allocators_cached_(0) {
+  // NUMA-partitioned CPU allocation can also be requested via the
+  // environment, so that serving binaries get per-node BFC regions without a
+  // code change. EnableNUMA() remains the programmatic way to turn it on.
+  bool numa_from_env = false;
+  Status status =
+      ReadBoolFromEnvVar("TF_CPU_ALLOCATOR_USE_NUMA", false, &numa_from_env);
+  if (!status.ok()) {
+    LOG(ERROR) << "ProcessState: " << status.error_message();
+  }
+  if (numa_from_env && port::NUMAEnabled()) {
+    numa_enabled_ = true;
+  }
+}
 
 string ProcessState::MemDesc::DebugString() {
   return strings::StrCat((loc == CPU ? "CPU " : "GPU "), dev_index,
@@ -62,7 +76,15 @@ ProcessState::MemDesc ProcessState::PtrType(const void* ptr) {
 }
 
 Allocator* ProcessState::GetCPUAllocator(int numa_node) {
-  if (!numa_enabled_ || numa_node == port::kNUMANoAffinity) numa_node = 0;
+  if (!numa_enabled_) {
+    numa_node = 0;
+  } else if (numa_node == port::kNUMANoAffinity) {
+    // The caller expressed no placement preference: allocate on the node the
+    // requesting thread is running on, so the tensor lands on the socket
+    // that will compute on it.
+    numa_node = port::NUMAGetThreadNodeAffinity();
+    if (numa_node == port::kNUMANoAffinity) numa_node = 0;
+  }
 
   // Check if allocator for the numa node is in lock-free cache.
   if (numa_node < cpu_allocators_cached_.load(std::memory_order_acquire)) {
@@ -71,6 +93,10 @@ Allocator* ProcessState::GetCPUAllocator(int numa_node) {
 
   mutex_lock lock(mu_);
   while (cpu_allocators_.size() <= static_cast<size_t>(numa_node)) {
+    // The allocator being created binds to the node matching its index in
+    // cpu_allocators_, which is not necessarily the requested node when
+    // intermediate entries have to be filled in.
+    const int node_being_created = static_cast<int>(cpu_allocators_.size());
     // If visitors have been defined we need an Allocator built from
     // a SubAllocator.  Prefer BFCAllocator, but fall back to PoolAllocator
     // depending on env var setting.
@@ -86,7 +112,7 @@ Allocator* ProcessState::GetCPUAllocator(int numa_node) {
     SubAllocator* sub_allocator =
         (numa_enabled_ || alloc_visitors_defined || use_bfc_allocator)
             ? new BasicCPUAllocator(
-                  numa_enabled_ ? numa_node : port::kNUMANoAffinity,
+                  numa_enabled_ ? node_being_created : port::kNUMANoAffinity,
                   cpu_alloc_visitors_, cpu_free_visitors_)
             : nullptr;
     if (use_bfc_allocator) {
@@ -103,9 +129,14 @@ Allocator* ProcessState::GetCPUAllocator(int numa_node) {
 
       BFCAllocator::Options allocator_opts;
       allocator_opts.allow_growth = true;
+      // Give each NUMA node's region its own name so that per-allocator
+      // metrics stay distinguishable when several regions exist.
       allocator = new BFCAllocator(
           absl::WrapUnique(sub_allocator), cpu_mem_limit,
-          /*name=*/"bfc_cpu_allocator_for_gpu", allocator_opts);
+          /*name=*/numa_enabled_
+              ? strings::StrCat("bfc_cpu_allocator_numa_", node_being_created)
+              : "bfc_cpu_allocator_for_gpu",
+          allocator_opts);
 
       VLOG(2) << "Using BFCAllocator with memory limit of "
               << cpu_mem_limit_in_mb << " MB for ProcessState CPU allocator";
@@ -116,7 +147,7 @@ Allocator* ProcessState::GetCPUAllocator(int numa_node) {
                             sub_allocator, new NoopRounder, "cpu_pool");
       VLOG(2) << "Using PoolAllocator for ProcessState CPU allocator "
               << "numa_enabled_=" << numa_enabled_
-              << " numa_node=" << numa_node;
+              << " numa_node=" << node_being_created;
     } else {
       DCHECK(!sub_allocator);
       allocator = cpu_allocator_base();
@@ -64,7 +64,10 @@ class ProcessState : public ProcessStateInterface {
   MemDesc PtrType(const void* ptr);
 
   // Returns the one CPUAllocator used for the given numa_node.
-  // Treats numa_node == kNUMANoAffinity as numa_node == 0.
+  // When NUMA allocators are disabled, all nodes map to node 0. When they are
+  // enabled, numa_node == kNUMANoAffinity maps to the requesting thread's
+  // node (falling back to node 0 if the thread has no affinity), giving
+  // allocation affinity to the socket that computes on the tensor.
   Allocator* GetCPUAllocator(int numa_node) override;
 
   // Registers alloc visitor for the CPU allocator(s).
@@ -0,0 +1,56 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/common_runtime/process_state.h"
+
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/platform/numa.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+TEST(ProcessStateTest, CPUAllocatorResolvesWithoutNUMA) {
+  ProcessState* ps = ProcessState::singleton();
+  Allocator* node0 = ps->GetCPUAllocator(0);
+  ASSERT_NE(node0, nullptr);
+  // Without NUMA partitioning, every placement request resolves to the node-0
+  // allocator, including requests with no placement preference.
+  EXPECT_EQ(node0, ps->GetCPUAllocator(port::kNUMANoAffinity));
+  EXPECT_EQ(node0, ps->GetCPUAllocator(1));
+  void* ptr = node0->AllocateRaw(Allocator::kAllocatorAlignment, 1024);
+  EXPECT_NE(ptr, nullptr);
+  node0->DeallocateRaw(ptr);
+}
+
+TEST(ProcessStateTest, NUMAPartitionedAllocatorsAreUsable) {
+  ProcessState* ps = ProcessState::singleton();
+  ps->EnableNUMA();
+  // Whether or not the platform reports NUMA nodes, a request with no
+  // affinity must resolve to a usable allocator: the requesting thread's
+  // node on NUMA hosts, or node 0 for unbound threads and non-NUMA hosts.
+  Allocator* no_affinity = ps->GetCPUAllocator(port::kNUMANoAffinity);
+  ASSERT_NE(no_affinity, nullptr);
+  void* ptr = no_affinity->AllocateRaw(Allocator::kAllocatorAlignment, 1024);
+  EXPECT_NE(ptr, nullptr);
+  no_affinity->DeallocateRaw(ptr);
+  // Repeated requests for the same node stay stable.
+  Allocator* node0 = ps->GetCPUAllocator(0);
+  ASSERT_NE(node0, nullptr);
+  EXPECT_EQ(node0, ps->GetCPUAllocator(0));
+}
+
+}  // namespace
+}  // namespace tensorflow
@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "tensorflow/core/common_runtime/process_util.h"
 
+#include <cstdlib>
+
 #if defined(ENABLE_MKL) && defined(ENABLE_ONEDNN_OPENMP)
 #ifdef _OPENMP
 #include <omp.h>
@@ -25,7 +27,9 @@ limitations under the License.
 #include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/platform/byte_order.h"
 #include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/lib/strings/numbers.h"
 #include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/numa.h"
 #include "tensorflow/core/platform/tracing.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/util/util.h"
@@ -71,6 +75,28 @@ int32 DefaultNumInterOpThreads() {
 #endif
 }
 
+
+// Returns the ThreadOptions for runtime compute pools. With
+// TF_COMPUTE_POOL_NUMA_NODE=<node>, worker threads are bound to that NUMA
+// node (the pool wrapper applies the binding at thread startup), which on
+// multi-socket hosts keeps a process's workers from bouncing across
+// sockets mid-reduction. Deployments running one process per socket set
+// the node per process; the default remains unbound.
+static ThreadOptions ComputePoolThreadOptions() {
+  ThreadOptions thread_options;
+  static const int numa_node = [] {
+    int64_t value = port::kNUMANoAffinity;
+    const char* env = std::getenv("TF_COMPUTE_POOL_NUMA_NODE");
+    if (env != nullptr && !strings::safe_strto64(env, &value)) {
+      LOG(WARNING) << "Invalid TF_COMPUTE_POOL_NUMA_NODE: " << env;
+      value = port::kNUMANoAffinity;
+    }
+    return static_cast<int>(value);
+  }();
+  thread_options.numa_node = numa_node;
+  return thread_options;
+}
+
 static thread::ThreadPool* InitComputePool(const SessionOptions& options) {
   int32_t inter_op_parallelism_threads =
       options.config.inter_op_parallelism_threads();
@@ -78,7 +104,8 @@ static thread::ThreadPool* InitComputePool(const SessionOptions& options) {
     inter_op_parallelism_threads = DefaultNumInterOpThreads();
   }
   return new thread::ThreadPool(
-      Env::Default(), ThreadOptions(), "Compute", inter_op_parallelism_threads,
+      Env::Default(), ComputePoolThreadOptions(), "Compute",
+      inter_op_parallelism_threads,
       !options.config.experimental().disable_thread_spinning(),
       /*allocator=*/nullptr);
 }
@@ -158,7 +185,7 @@ thread::ThreadPool* NewThreadPoolFromSessionOptions(
   const int32_t num_threads = NumInterOpThreadsFromSessionOptions(options);
   VLOG(1) << "Session inter op parallelism threads: " << num_threads;
   return new thread::ThreadPool(
-      options.env, ThreadOptions(), "Compute", num_threads,
+      options.env, ComputePoolThreadOptions(), "Compute", num_threads,
       !options.config.experimental().disable_thread_spinning(),
       /*allocator=*/nullptr);
 }
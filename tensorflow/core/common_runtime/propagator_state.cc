@@ -33,22 +33,26 @@ PropagatorState::PropagatorState(const ImmutableExecutorState& immutable_state,
   // We start the entire execution in iteration 0 of the root frame
   // so let us create the root frame and the state for iteration 0.
   // We assume root_frame_->frame_name.empty().
-  root_frame_ = new FrameState(immutable_state_, 1);
+  root_frame_ = step_allocator_.New<FrameState>(immutable_state_, 1,
+                                                &step_allocator_);
   root_frame_->frame_id = 0;  // must be 0
   root_frame_->InitializeFrameInfo(immutable_state_.get_root_frame_info());
 
   // Initialize iteration 0.
   root_frame_->SetIteration(
-      0, new PropagatorState::IterationState(0, root_frame_->pending_counts,
-                                             root_frame_->total_input_tensors));
+      0, step_allocator_.New<PropagatorState::IterationState>(
+             &step_allocator_, 0, root_frame_->pending_counts,
+             root_frame_->total_input_tensors));
 
   outstanding_frames_.emplace(root_frame_->frame_id, root_frame_);
 }
 
 PropagatorState::~PropagatorState() {
   for (auto name_frame : outstanding_frames_) {
-    delete name_frame.second;
+    name_frame.second->~FrameState();
   }
+  // The storage for the frames, iterations and entries is released in one
+  // shot when `step_allocator_` is destroyed.
 }
 
 void PropagatorState::ActivateRoots(gtl::ArraySlice<const NodeItem*> roots,
@@ -255,8 +259,8 @@ void PropagatorState::FindOrCreateChildFrame(FrameState* frame,
     VLOG(2) << "Create frame: " << child_name << " id: " << child_id;
   }
 
-  FrameState* temp =
-      new FrameState(immutable_state_, frame_info.parallel_iterations);
+  FrameState* temp = step_allocator_.New<FrameState>(
+      immutable_state_, frame_info.parallel_iterations, &step_allocator_);
   temp->frame_id = child_id;
   temp->parent_frame = frame;
   temp->parent_iter = iter_state;
@@ -265,8 +269,10 @@ void PropagatorState::FindOrCreateChildFrame(FrameState* frame,
   // Initialize iteration 0.
   {
     mutex_lock l(temp->mu);
-    temp->SetIteration(0, new IterationState(0, temp->pending_counts,
-                                             temp->total_input_tensors));
+    temp->SetIteration(
+        0, step_allocator_.New<IterationState>(&step_allocator_, 0,
+                                               temp->pending_counts,
+                                               temp->total_input_tensors));
   }
 
   {
@@ -282,7 +288,11 @@ void PropagatorState::FindOrCreateChildFrame(FrameState* frame,
       temp = nullptr;
     }
   }
-  delete temp;  // Not used so delete it.
+  if (temp != nullptr) {
+    // Not used so destroy it and recycle its storage.
+    temp->~FrameState();
+    step_allocator_.Free(temp, sizeof(FrameState));
+  }
 }
 
 void PropagatorState::DeleteFrame(FrameState* frame, TaggedNodeSeq* ready) {
@@ -359,7 +369,8 @@ void PropagatorState::DeleteFrame(FrameState* frame, TaggedNodeSeq* ready) {
     mutex_lock executor_lock(mu_);
     outstanding_frames_.erase(frame->frame_id);
   }
-  delete frame;
+  frame->~FrameState();
+  step_allocator_.Free(frame, sizeof(FrameState));
 }
 
 void PropagatorState::CleanupFramesIterations(FrameState* frame,
@@ -411,6 +422,21 @@ int PropagatorState::FrameState::ActivateNodesFastPathInternal(
   } while (0);
 
   Entry* input_tensors = iter_state->input_tensors;
+
+  // For wide fan-out, the destinations' count bytes land on scattered cache
+  // lines; issue prefetches for all of them before the propagation loop so
+  // the adjust_for_activation loads below don't stall serially.
+  constexpr int kPrefetchFanOutThreshold = 4;
+  if (item->num_output_edges + item->num_output_control_edges >
+      kPrefetchFanOutThreshold) {
+    for (const EdgeInfo& e : item->output_edges()) {
+      iter_state->prefetch_counts(immutable_state.pending_ids()[e.dst_id]);
+    }
+    for (const ControlEdgeInfo& e : item->output_control_edges()) {
+      iter_state->prefetch_counts(immutable_state.pending_ids()[e.dst_id]);
+    }
+  }
+
   for (const EdgeInfo& e : item->output_edges()) {
     const int dst_id = e.dst_id;
     const PendingCounts::Handle dst_pending_id =
@@ -661,8 +687,8 @@ PropagatorState::FrameState::IncrementIteration(TaggedNodeSeq* ready) {
   iteration_count++;
 
   // Initialize the next iteration.
-  IterationState* next_iter =
-      new IterationState(iteration_count, pending_counts, total_input_tensors);
+  IterationState* next_iter = step_allocator->New<IterationState>(
+      step_allocator, iteration_count, pending_counts, total_input_tensors);
   SetIteration(iteration_count, next_iter);
   num_outstanding_iterations++;
   dead_exits.clear();
@@ -680,7 +706,7 @@ bool PropagatorState::FrameState::CleanupIterations(IterationState* iter_state,
                                                     TaggedNodeSeq* ready) {
   int64_t curr_iter = iter_state->iter_num;
   while (curr_iter <= iteration_count && IsIterationDone(iter_state)) {
-    delete iter_state;
+    iter_state->Destroy(step_allocator);
     SetIteration(curr_iter, nullptr);
     --num_outstanding_iterations;
     ++curr_iter;
@@ -15,7 +15,9 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_COMMON_RUNTIME_PROPAGATOR_STATE_H_
 #define TENSORFLOW_CORE_COMMON_RUNTIME_PROPAGATOR_STATE_H_
 
+#include <new>
 #include <queue>
+#include <utility>
 #include <vector>
 
 #include "tensorflow/core/common_runtime/entry.h"
@@ -23,6 +25,7 @@ limitations under the License.
 #include "tensorflow/core/common_runtime/pending_counts.h"
 #include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/control_flow.h"
+#include "tensorflow/core/lib/core/arena.h"
 #include "tensorflow/core/lib/gtl/flatmap.h"
 #include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/platform/env.h"
@@ -56,6 +59,70 @@ class PropagatorState {
   struct FrameState;
   struct IterationState;
 
+  // A thread-safe bump-pointer allocator that owns all `FrameState`,
+  // `IterationState` and `Entry` storage for a single step.
+  //
+  // Objects placed in the allocator must be destroyed individually (their
+  // destructors still run tensor cleanup), but the underlying blocks are
+  // released in one shot when the `PropagatorState` is destroyed, avoiding
+  // per-object malloc/free churn on the executor hot path.
+  class StepAllocator {
+   public:
+    StepAllocator() : arena_(kBlockSize) {}
+
+    void* Alloc(size_t size, size_t alignment) {
+      mutex_lock l(mu_);
+      std::vector<void*>& free_list = free_blocks_[size];
+      if (!free_list.empty()) {
+        void* ptr = free_list.back();
+        free_list.pop_back();
+        return ptr;
+      }
+      return arena_.AllocAligned(size, alignment);
+    }
+
+    // Returns a block previously obtained from `Alloc` to the allocator so
+    // that it can be reused by a later allocation of the same size. This
+    // keeps the arena footprint bounded by the *peak* live state of the step
+    // rather than its cumulative allocations (e.g. for loops that retire many
+    // iterations during a single step).
+    void Free(void* ptr, size_t size) {
+      mutex_lock l(mu_);
+      free_blocks_[size].push_back(ptr);
+    }
+
+    // Constructs a `T` in arena-owned storage. The caller is responsible for
+    // invoking `~T()` when the object is logically deleted; the storage
+    // itself is reclaimed when the arena is destroyed.
+    template <typename T, typename... Args>
+    T* New(Args&&... args) {
+      return new (Alloc(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    // Constructs an array of `n` default-initialized `Entry` objects in
+    // arena-owned storage.
+    Entry* NewEntries(int n) {
+      Entry* entries =
+          static_cast<Entry*>(Alloc(sizeof(Entry) * n, alignof(Entry)));
+      for (int i = 0; i < n; ++i) {
+        new (&entries[i]) Entry;
+      }
+      return entries;
+    }
+
+   private:
+    // Most steps fit their control-flow state in a few blocks of this size.
+    static constexpr size_t kBlockSize = 64 << 10;
+
+    mutex mu_;
+    core::Arena arena_ TF_GUARDED_BY(mu_);
+
+    // Blocks returned by `Free`, bucketed by size for exact-size reuse. All
+    // blocks in a bucket come from allocations of the same type(s), so the
+    // original alignment is preserved.
+    gtl::FlatMap<size_t, std::vector<void*>> free_blocks_ TF_GUARDED_BY(mu_);
+  };
+
  public:
   // A `TaggedNode` corresponds to a single invocation of a node's kernel,
   // and it is created when the kernel becomes runnable (in a particular
@@ -122,11 +189,12 @@ class PropagatorState {
  private:
   // The state of an iteration in a particular frame.
   struct IterationState {
-    explicit IterationState(int64_t iter_num,
+    explicit IterationState(StepAllocator* allocator, int64_t iter_num,
                             const PendingCounts* pending_counts,
                             int total_input_tensors)
         : iter_num(iter_num),
-          input_tensors(new Entry[total_input_tensors]),
+          input_tensors(allocator->NewEntries(total_input_tensors)),
+          num_input_tensors(total_input_tensors),
           outstanding_ops(0),
           outstanding_frame_count(0),
           counts(*pending_counts) {  // Initialize with copy of *pending_counts
@@ -143,8 +211,14 @@ class PropagatorState {
     // is resized once. Each element of tensors_ is written once by the
     // source node of an edge and is cleared by the destination of the same
     // edge. The latter node is never run concurrently with the former node.
+    //
+    // The array is owned by the step's `StepAllocator`; the destructor runs
+    // the element destructors but does not free the storage.
     Entry* input_tensors;
 
+    // The length of the `input_tensors` array.
+    const int num_input_tensors;
+
     // The number of outstanding ops for each iteration.
     std::atomic<size_t> outstanding_ops;
 
@@ -177,8 +251,27 @@ class PropagatorState {
         PendingCounts::Handle h, bool increment_dead) {
       return counts.adjust_for_activation_atomic(h, increment_dead);
     }
+    // Prefetches the count bytes for "h"; see PendingCounts::prefetch.
+    void prefetch_counts(PendingCounts::Handle h) { counts.prefetch(h); }
 
-    ~IterationState() { delete[] input_tensors; }
+    ~IterationState() {
+      for (int i = 0; i < num_input_tensors; ++i) {
+        input_tensors[i].~Entry();
+      }
+    }
+
+    // Destroys this iteration and returns its storage to `allocator` for
+    // reuse by later iterations in the same step. Used when an iteration
+    // retires mid-step; iterations that survive until the end of the step are
+    // destroyed without recycling, since the arena is about to be released
+    // wholesale anyway.
+    void Destroy(StepAllocator* allocator) {
+      Entry* entries = input_tensors;
+      const int n = num_input_tensors;
+      this->~IterationState();
+      allocator->Free(entries, sizeof(Entry) * n);
+      allocator->Free(this, sizeof(IterationState));
+    }
 
    private:
     PendingCounts counts;
@@ -186,8 +279,9 @@ class PropagatorState {
 
   struct FrameState {
     explicit FrameState(const ImmutableExecutorState& immutable_state,
-                        int parallel_iters)
+                        int parallel_iters, StepAllocator* allocator)
         : immutable_state(immutable_state),
+          step_allocator(allocator),
           max_parallel_iterations(parallel_iters),
           num_outstanding_iterations(1),
           iterations(parallel_iters + 1),
@@ -224,6 +318,9 @@ class PropagatorState {
     // The immutable state of the executor the frame is in.
     const ImmutableExecutorState& immutable_state;
 
+    // The step-scoped allocator that owns this frame and its iterations.
+    StepAllocator* const step_allocator;
+
     // The name of this frame, which is the concatenation of its parent
     // frame name, the iteration of the parent frame when this frame was
     // created, and the value of the attr 'frame_name'.
@@ -386,8 +483,10 @@ class PropagatorState {
 
     ~FrameState() {
       for (size_t i = 0; i < iterations.size(); ++i) {
-        delete iterations[i];
-        iterations[i] = nullptr;
+        if (iterations[i] != nullptr) {
+          iterations[i]->~IterationState();
+          iterations[i] = nullptr;
+        }
       }
     }
 
@@ -498,6 +597,11 @@ class PropagatorState {
   const int64_t step_id_;
   const bool vlog_;
 
+  // Owns the storage for all frames, iterations and entries created during
+  // this step. Destroyed (releasing all blocks at once) after the frames have
+  // been destroyed in `~PropagatorState()`.
+  StepAllocator step_allocator_;
+
   mutex mu_;
 
   // The root frame in which the execution of this step is started.
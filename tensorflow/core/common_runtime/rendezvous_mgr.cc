@@ -168,6 +168,13 @@ Status RefCountedIntraProcessRendezvous::Send(const ParsedKey& key,
   return local_.Send(key, args, val, is_dead);
 }
 
+Status RefCountedIntraProcessRendezvous::SendBatch(
+    gtl::ArraySlice<BatchedSend> sends) {
+  VLOG(1) << "IntraProcessRendezvous SendBatch " << this << " "
+          << sends.size() << " tensors";
+  return local_.SendBatch(sends);
+}
+
 void RefCountedIntraProcessRendezvous::RecvAsync(const ParsedKey& key,
                                                  const Rendezvous::Args& args,
                                                  DoneCallback done) {
@@ -197,6 +204,13 @@ Status PrivateIntraProcessRendezvous::Send(const ParsedKey& key,
   return local_.Send(key, args, val, is_dead);
 }
 
+Status PrivateIntraProcessRendezvous::SendBatch(
+    gtl::ArraySlice<BatchedSend> sends) {
+  DVLOG(1) << "IntraProcessRendezvous SendBatch " << this << " "
+           << sends.size() << " tensors";
+  return local_.SendBatch(sends);
+}
+
 void PrivateIntraProcessRendezvous::RecvAsync(const ParsedKey& key,
                                               const Rendezvous::Args& args,
                                               DoneCallback done) {
@@ -51,6 +51,10 @@ class RefCountedIntraProcessRendezvous : public Rendezvous {
                  DoneCallback done) override;
   void StartAbort(const Status& status) override;
 
+  // Publishes a whole set of tensors (e.g. one partition boundary's worth)
+  // with a single rendezvous synchronization. See LocalRendezvous::SendBatch.
+  Status SendBatch(gtl::ArraySlice<BatchedSend> sends) override;
+
   // Returns the member LocalRendezvous' status.
   Status GetLocalRendezvousStatus();
 
@@ -87,6 +91,10 @@ class PrivateIntraProcessRendezvous : public RendezvousInterface {
                  DoneCallback done) override;
   void StartAbort(const Status& status) override;
 
+  // Publishes a whole set of tensors (e.g. one partition boundary's worth)
+  // with a single rendezvous synchronization. See LocalRendezvous::SendBatch.
+  Status SendBatch(gtl::ArraySlice<BatchedSend> sends) override;
+
  private:
   const DeviceMgr* device_mgr_;
   LocalRendezvous local_;
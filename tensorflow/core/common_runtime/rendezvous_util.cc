@@ -13,6 +13,8 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 #include "tensorflow/core/common_runtime/rendezvous_util.h"
+
+#include <vector>
 #include "tensorflow/core/platform/mutex.h"
 
 #include "tensorflow/core/util/reffed_status_callback.h"
@@ -39,17 +41,23 @@ Status SendTensorsToRendezvous(
     return errors::InvalidArgument("Rendezvous is null.");
   }
 
-  Rendezvous::ParsedKey parsed;
+  // Publish the whole set with one rendezvous synchronization; see
+  // RendezvousInterface::SendBatch. The parsed keys must outlive the call.
+  std::vector<Rendezvous::ParsedKey> parsed_keys(keys.size());
+  std::vector<Rendezvous::BatchedSend> sends(keys.size());
   for (int i = 0; i < keys.size(); ++i) {
     Rendezvous::Args rendez_args;
     rendez_args.device_context = device_context;
     if (!alloc_attrs.empty()) {
       rendez_args.alloc_attrs = alloc_attrs[i];
     }
-    TF_RETURN_IF_ERROR(Rendezvous::ParseKey(keys[i], &parsed));
-    TF_RETURN_IF_ERROR(
-        rendezvous->Send(parsed, rendez_args, tensors_to_send[i], false));
+    TF_RETURN_IF_ERROR(Rendezvous::ParseKey(keys[i], &parsed_keys[i]));
+    sends[i].key = &parsed_keys[i];
+    sends[i].args = rendez_args;
+    sends[i].val = &tensors_to_send[i];
+    sends[i].is_dead = false;
   }
+  TF_RETURN_IF_ERROR(rendezvous->SendBatch(sends));
   return Status::OK();
 }
 
@@ -25,10 +25,12 @@ limitations under the License.
 #include "tensorflow/core/framework/bounds_check.h"
 #include "tensorflow/core/framework/common_shape_fns.h"
 #include "tensorflow/core/framework/node_def.pb.h"
+#include "tensorflow/core/framework/node_def_util.h"
 #include "tensorflow/core/framework/shape_inference.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/framework/tensor.pb.h"
 #include "tensorflow/core/framework/versions.pb.h"
+#include "tensorflow/core/lib/strings/strcat.h"
 #include "tensorflow/core/graph/algorithm.h"
 #include "tensorflow/core/lib/core/errors.h"
 
@@ -682,6 +684,44 @@ Status ShapeRefiner::RunShapeFn(const Node* node,
   c->set_input_tensors(input_tensors);
   c->set_input_tensors_as_shapes(input_tensors_as_shapes);
 
+  // Shape functions are pure in (op, attrs, input shapes) unless they
+  // consult input values or resource handle data, so their results can be
+  // memoized. Build the signature up front; it is also the condition for
+  // the node being cacheable at all (function calls and nodes with handle
+  // data are excluded).
+  string cache_signature;
+  const bool maybe_cacheable =
+      !(function_library_ && IsFunctionCall(*function_library_, *node)) &&
+      op_reg_data->shape_inference_fn != nullptr;
+  if (maybe_cacheable) {
+    bool has_handle_data = false;
+    for (int i = 0; i < c->num_inputs(); ++i) {
+      if (c->input_handle_shapes_and_types(i) != nullptr) {
+        has_handle_data = true;
+        break;
+      }
+    }
+    if (!has_handle_data) {
+      cache_signature = strings::StrCat(node->type_string(), "|");
+      strings::StrAppend(&cache_signature, SummarizeAttrsHelper(node->def(), ""),
+                         "|");
+      for (int i = 0; i < c->num_inputs(); ++i) {
+        strings::StrAppend(&cache_signature, c->DebugString(c->input(i)), ",");
+      }
+      ShapeInferenceCache::Entry entry;
+      if (shape_cache_->Lookup(cache_signature, &entry) &&
+          static_cast<int>(entry.output_shapes.size()) == c->num_outputs()) {
+        for (int i = 0; i < c->num_outputs(); ++i) {
+          ShapeHandle h;
+          TF_RETURN_IF_ERROR(
+              c->MakeShapeFromShapeProto(entry.output_shapes[i], &h));
+          c->set_output(i, h);
+        }
+        return Status::OK();
+      }
+    }
+  }
+
   // Run the shape inference function, and return if there was an error.
   // Capture as lambda, because we might need to re-run inference later on.
   auto run_inference_lambda = [&]() {
@@ -783,6 +823,31 @@ Status ShapeRefiner::RunShapeFn(const Node* node,
     }
   } while (rerun_shape_fn);
 
+  // Populate the cache if the invocation turned out to be value-independent:
+  // no input tensors or tensor-as-shape conversions were requested, and no
+  // handle data was produced.
+  if (!cache_signature.empty()) {
+    bool cacheable = true;
+    for (int i = 0; i < c->num_inputs(); ++i) {
+      if (c->requested_input_tensor(i) ||
+          c->requested_input_tensor_as_partial_shape(i)) {
+        cacheable = false;
+        break;
+      }
+    }
+    for (int i = 0; cacheable && i < c->num_outputs(); ++i) {
+      if (c->output_handle_shapes_and_types(i) != nullptr) cacheable = false;
+    }
+    if (cacheable) {
+      ShapeInferenceCache::Entry entry;
+      entry.output_shapes.resize(c->num_outputs());
+      for (int i = 0; i < c->num_outputs(); ++i) {
+        c->ShapeHandleToProto(c->output(i), &entry.output_shapes[i]);
+      }
+      shape_cache_->Insert(cache_signature, std::move(entry));
+    }
+  }
+
   return Status::OK();
 }
 
@@ -15,15 +15,19 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_COMMON_RUNTIME_SHAPE_REFINER_H_
 #define TENSORFLOW_CORE_COMMON_RUNTIME_SHAPE_REFINER_H_
 
+#include <memory>
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "tensorflow/core/common_runtime/graph_runner.h"
 #include "tensorflow/core/framework/function.pb.h"
 #include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/framework/tensor_shape.pb.h"
 #include "tensorflow/core/graph/graph.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/thread_annotations.h"
 
 namespace tensorflow {
 namespace grappler {
@@ -65,6 +69,39 @@ class ExtendedInferenceContext {
   TF_DISALLOW_COPY_AND_ASSIGN(ExtendedInferenceContext);
 };
 
+// A cache of shape-function results keyed by a signature of (op type,
+// attrs, input shapes). Shape functions are pure with respect to that
+// signature as long as they never consult input *values* or resource handle
+// data, so results can be reused across nodes, refiners and optimization
+// passes; RunShapeFn only consults/populates the cache for invocations that
+// meet those conditions. Shareable between ShapeRefiner instances via
+// ShapeRefiner::set_shape_cache, in which case callers are responsible for
+// not reusing a cache across incompatible op registries.
+class ShapeInferenceCache {
+ public:
+  // The cached outputs of one shape-function invocation.
+  struct Entry {
+    std::vector<TensorShapeProto> output_shapes;
+  };
+
+  bool Lookup(const string& signature, Entry* entry) {
+    mutex_lock l(mu_);
+    auto it = entries_.find(signature);
+    if (it == entries_.end()) return false;
+    *entry = it->second;
+    return true;
+  }
+
+  void Insert(const string& signature, Entry entry) {
+    mutex_lock l(mu_);
+    entries_.emplace(signature, std::move(entry));
+  }
+
+ private:
+  mutex mu_;
+  absl::flat_hash_map<string, Entry> entries_ TF_GUARDED_BY(mu_);
+};
+
 // ShapeRefiner performs shape inference for TensorFlow Graphs.  It is
 // responsible for instantiating InferenceContext objects for each
 // Node in the Graph, and providing/storing the 'input_tensor' Tensors
@@ -134,6 +171,16 @@ class ShapeRefiner {
   void set_require_shape_inference_fns(bool require_shape_inference_fns) {
     require_shape_inference_fns_ = require_shape_inference_fns;
   }
+
+  // Shares `cache` with this refiner, so that shape-function results
+  // memoized by other refiners or optimization passes over the same op
+  // registry are reused instead of re-inferred.
+  void set_shape_cache(std::shared_ptr<ShapeInferenceCache> cache) {
+    shape_cache_ = std::move(cache);
+  }
+  const std::shared_ptr<ShapeInferenceCache>& shape_cache() const {
+    return shape_cache_;
+  }
   void set_disable_constant_propagation(bool disable) {
     disable_constant_propagation_ = disable;
   }
@@ -316,6 +363,12 @@ class ShapeRefiner {
   bool require_shape_inference_fns_ = true;
   bool disable_constant_propagation_ = false;
 
+  // Memoizes value-independent shape-function results; see
+  // ShapeInferenceCache. Shared across refiners when set_shape_cache is
+  // called, per-refiner otherwise.
+  std::shared_ptr<ShapeInferenceCache> shape_cache_ =
+      std::make_shared<ShapeInferenceCache>();
+
   // Function library is optional, but has to be set to enable function
   // shape inference.
   const tensorflow::FunctionLibraryDefinition* function_library_ = nullptr;
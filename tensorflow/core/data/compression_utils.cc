@@ -161,5 +161,176 @@ Status UncompressElement(const CompressedElement& compressed,
   return Status::OK();
 }
 
+Status CompressElementBatch(const std::vector<std::vector<Tensor>>& elements,
+                            CompressedElementBatch* out) {
+  if (elements.empty()) {
+    return errors::InvalidArgument("Cannot compress an empty batch.");
+  }
+  const size_t num_components = elements[0].size();
+  for (const std::vector<Tensor>& element : elements) {
+    if (element.size() != num_components) {
+      return errors::InvalidArgument(
+          "All elements in a compressed batch must have the same number of "
+          "components; expected ",
+          num_components, " but found an element with ", element.size(), ".");
+    }
+  }
+  out->set_num_elements(elements.size());
+
+  // Step 1: Determine the total uncompressed size in component-major
+  // ("columnar") order, serializing non-memcopyable tensors along the way.
+  std::vector<TensorProto> non_memcpy_components;
+  size_t total_size = 0;
+  for (size_t c = 0; c < num_components; ++c) {
+    for (const std::vector<Tensor>& element : elements) {
+      const Tensor& component = element[c];
+      if (DataTypeCanUseMemcpy(component.dtype())) {
+        const TensorBuffer* buffer = DMAHelper::buffer(&component);
+        if (buffer) {
+          total_size += buffer->size();
+        }
+      } else {
+        non_memcpy_components.emplace_back();
+        component.AsProtoTensorContent(&non_memcpy_components.back());
+        total_size += non_memcpy_components.back().ByteSizeLong();
+      }
+    }
+  }
+  if (total_size > kuint32max) {
+    return errors::OutOfRange("Encountered a batch of size ", total_size,
+                              ", exceeding the 4GB Snappy limit.");
+  }
+
+  // Step 2: Lay the component columns out contiguously and compress the
+  // whole batch in one pass.
+  tstring uncompressed;
+  uncompressed.resize_uninitialized(total_size);
+  char* position = uncompressed.mdata();
+  int non_memcpy_component_index = 0;
+  for (size_t c = 0; c < num_components; ++c) {
+    for (const std::vector<Tensor>& element : elements) {
+      const Tensor& component = element[c];
+      CompressedComponentMetadata* metadata =
+          out->mutable_component_metadata()->Add();
+      metadata->set_dtype(component.dtype());
+      component.shape().AsProto(metadata->mutable_tensor_shape());
+      if (DataTypeCanUseMemcpy(component.dtype())) {
+        const TensorBuffer* buffer = DMAHelper::buffer(&component);
+        if (buffer) {
+          memcpy(position, buffer->data(), buffer->size());
+          metadata->set_tensor_size_bytes(buffer->size());
+        }
+      } else {
+        TensorProto& proto =
+            non_memcpy_components[non_memcpy_component_index++];
+        proto.SerializeToArray(position, proto.ByteSizeLong());
+        metadata->set_tensor_size_bytes(proto.ByteSizeLong());
+      }
+      position += metadata->tensor_size_bytes();
+    }
+  }
+  DCHECK_EQ(position, uncompressed.mdata() + total_size);
+
+  if (!port::Snappy_Compress(uncompressed.mdata(), total_size,
+                             out->mutable_data())) {
+    return errors::Internal("Failed to compress using snappy.");
+  }
+  VLOG(3) << "Compressed a batch of " << elements.size() << " elements from "
+          << total_size << " bytes to " << out->data().size() << " bytes";
+  return Status::OK();
+}
+
+Status UncompressElementBatch(const CompressedElementBatch& compressed,
+                              std::vector<std::vector<Tensor>>* out) {
+  const int64_t num_elements = compressed.num_elements();
+  if (num_elements <= 0 ||
+      compressed.component_metadata_size() % num_elements != 0) {
+    return errors::InvalidArgument(
+        "Malformed CompressedElementBatch: ",
+        compressed.component_metadata_size(), " metadata entries for ",
+        num_elements, " elements.");
+  }
+  const int64_t num_components =
+      compressed.component_metadata_size() / num_elements;
+  out->clear();
+  out->resize(num_elements);
+
+  // Step 1: Prepare the memory to uncompress into, in the same
+  // component-major order the data was written.
+  const int num_chunks = compressed.component_metadata_size();
+  std::vector<struct iovec> iov(num_chunks);
+  std::vector<tstring> tensor_proto_strs;
+  tensor_proto_strs.reserve(num_chunks);
+  int64_t total_size = 0;
+  for (int64_t c = 0; c < num_components; ++c) {
+    for (int64_t e = 0; e < num_elements; ++e) {
+      const int chunk = c * num_elements + e;
+      const CompressedComponentMetadata& metadata =
+          compressed.component_metadata(chunk);
+      std::vector<Tensor>& element = out->at(e);
+      if (DataTypeCanUseMemcpy(metadata.dtype())) {
+        element.emplace_back(metadata.dtype(), metadata.tensor_shape());
+        TensorBuffer* buffer = DMAHelper::buffer(&element.back());
+        if (buffer) {
+          iov[chunk].iov_base = buffer->data();
+          iov[chunk].iov_len = buffer->size();
+        } else {
+          iov[chunk].iov_base = nullptr;
+          iov[chunk].iov_len = 0;
+        }
+      } else {
+        element.emplace_back();
+        tensor_proto_strs.emplace_back();
+        tstring& tensor_proto_str = tensor_proto_strs.back();
+        tensor_proto_str.resize_uninitialized(metadata.tensor_size_bytes());
+        iov[chunk].iov_base = tensor_proto_str.mdata();
+        iov[chunk].iov_len = tensor_proto_str.size();
+      }
+      total_size += iov[chunk].iov_len;
+    }
+  }
+
+  // Step 2: Uncompress into the iovec.
+  const std::string& compressed_data = compressed.data();
+  size_t uncompressed_size;
+  if (!port::Snappy_GetUncompressedLength(
+          compressed_data.data(), compressed_data.size(),
+          &uncompressed_size)) {
+    return errors::Internal(
+        "Could not get snappy uncompressed length. Compressed data size: ",
+        compressed_data.size());
+  }
+  if (uncompressed_size != static_cast<size_t>(total_size)) {
+    return errors::Internal(
+        "Uncompressed size mismatch. Snappy expects ", uncompressed_size,
+        " whereas the tensor metadata suggests ", total_size);
+  }
+  if (!port::Snappy_UncompressToIOVec(compressed_data.data(),
+                                      compressed_data.size(), iov.data(),
+                                      num_chunks)) {
+    return errors::Internal("Failed to perform snappy decompression.");
+  }
+
+  // Step 3: Deserialize the TensorProto components.
+  int tensor_proto_strs_index = 0;
+  for (int64_t c = 0; c < num_components; ++c) {
+    for (int64_t e = 0; e < num_elements; ++e) {
+      const CompressedComponentMetadata& metadata =
+          compressed.component_metadata(c * num_elements + e);
+      if (DataTypeCanUseMemcpy(metadata.dtype())) {
+        continue;
+      }
+      TensorProto tp;
+      if (!tp.ParseFromString(tensor_proto_strs[tensor_proto_strs_index++])) {
+        return errors::Internal("Could not parse TensorProto");
+      }
+      if (!out->at(e).at(c).FromProto(tp)) {
+        return errors::Internal("Could not parse Tensor");
+      }
+    }
+  }
+  return Status::OK();
+}
+
 }  // namespace data
 }  // namespace tensorflow
@@ -35,6 +35,20 @@ Status CompressElement(const std::vector<Tensor>& element,
 Status UncompressElement(const CompressedElement& compressed,
                          std::vector<Tensor>* out);
 
+// Compresses `elements` together into one `CompressedElementBatch`,
+// coalescing the same-index components of all elements into contiguous
+// columnar blocks before compressing. Compared to compressing each element
+// individually this amortizes the compression setup and exposes
+// cross-element redundancy to the compressor, which matters for pipelines
+// with many sub-kilobyte elements. All elements must have the same number of
+// components.
+Status CompressElementBatch(const std::vector<std::vector<Tensor>>& elements,
+                            CompressedElementBatch* out);
+
+// Uncompresses a `CompressedElementBatch` back into its elements.
+Status UncompressElementBatch(const CompressedElementBatch& compressed,
+                              std::vector<std::vector<Tensor>>* out);
+
 }  // namespace data
 }  // namespace tensorflow
 
@@ -50,6 +50,35 @@ TEST_P(ParameterizedCompressionUtilsTest, RoundTrip) {
       ExpectEqual(element, round_trip_element, /*compare_order=*/true));
 }
 
+TEST_P(ParameterizedCompressionUtilsTest, BatchRoundTrip) {
+  std::vector<Tensor> element = GetParam();
+  if (element.empty()) {
+    return;
+  }
+  // A batch of three copies of the element.
+  std::vector<std::vector<Tensor>> elements = {element, element, element};
+  CompressedElementBatch compressed;
+  TF_ASSERT_OK(CompressElementBatch(elements, &compressed));
+  std::vector<std::vector<Tensor>> round_trip_elements;
+  TF_ASSERT_OK(UncompressElementBatch(compressed, &round_trip_elements));
+  ASSERT_EQ(elements.size(), round_trip_elements.size());
+  for (size_t i = 0; i < elements.size(); ++i) {
+    TF_EXPECT_OK(ExpectEqual(elements[i], round_trip_elements[i],
+                             /*compare_order=*/true));
+  }
+}
+
+TEST(CompressionUtilsTest, BatchComponentCountMismatch) {
+  std::vector<std::vector<Tensor>> elements = {
+      CreateTensors<int64_t>(TensorShape{1}, {{1}, {2}}),
+      CreateTensors<int64_t>(TensorShape{1}, {{3}}),
+  };
+  CompressedElementBatch compressed;
+  EXPECT_THAT(CompressElementBatch(elements, &compressed),
+              StatusIs(error::INVALID_ARGUMENT,
+                       HasSubstr("same number of components")));
+}
+
 std::vector<std::vector<Tensor>> TestCases() {
   return {
       CreateTensors<int64_t>(TensorShape{1}, {{1}}),           // int64
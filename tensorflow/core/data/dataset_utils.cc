@@ -74,6 +74,7 @@ constexpr char kMapParallelizationOpt[] = "map_parallelization";
 constexpr char kShuffleAndRepeatFusionOpt[] = "shuffle_and_repeat_fusion";
 constexpr char kFilterFusionOpt[] = "filter_fusion";
 constexpr char kMapAndFilterFusionOpt[] = "map_and_filter_fusion";
+constexpr char kMapFilterBatchFusionOpt[] = "map_filter_batch_fusion";
 constexpr char kMapFusionOpt[] = "map_fusion";
 constexpr char kParallelBatchOpt[] = "parallel_batch";
 constexpr char kAutotuneBufferSizesOpt[] = "autotune_buffer_sizes";
@@ -146,6 +147,14 @@ void DefaultOptimizationGraphRewrites(
       optimization_disabled->insert(kMapAndFilterFusionOpt);
     }
   }
+  if (optimization_options.optional_map_filter_batch_fusion_case() ==
+      OptimizationOptions::kMapFilterBatchFusion) {
+    if (optimization_options.map_filter_batch_fusion()) {
+      optimization_enabled->insert(kMapFilterBatchFusionOpt);
+    } else {
+      optimization_disabled->insert(kMapFilterBatchFusionOpt);
+    }
+  }
   if (optimization_options.optional_map_parallelization_case() ==
       OptimizationOptions::kMapParallelization) {
     if (optimization_options.map_parallelization()) {
@@ -558,14 +558,58 @@ void LocalWorkers::Add(absl::string_view worker_address,
   (*local_workers_)[worker_address] = worker;
 }
 
+namespace {
+
+// Returns true if `host` is a spelling of the local machine: a loopback
+// name/address or this host's own name.
+bool IsLocalHostName(absl::string_view host) {
+  return host == "localhost" || host == "127.0.0.1" || host == "::1" ||
+         host == port::Hostname();
+}
+
+// Splits "host:port" (or "[v6host]:port") into host and port. Returns false
+// if there is no port separator.
+bool SplitHostPort(absl::string_view address, absl::string_view* host,
+                   absl::string_view* port) {
+  size_t colon = address.rfind(':');
+  if (colon == absl::string_view::npos) return false;
+  *host = address.substr(0, colon);
+  *port = address.substr(colon + 1);
+  if (!host->empty() && host->front() == '[' && host->back() == ']') {
+    *host = host->substr(1, host->size() - 2);
+  }
+  return true;
+}
+
+}  // namespace
+
 std::shared_ptr<DataServiceWorkerImpl> LocalWorkers::Get(
     absl::string_view worker_address) {
   tf_shared_lock l(mu_);
   AddressToWorkerMap::const_iterator it = local_workers_->find(worker_address);
-  if (it == local_workers_->end()) {
+  if (it != local_workers_->end()) {
+    return it->second;
+  }
+  // The dispatcher may hand out this process's worker under a different
+  // spelling of the local host than the one it registered with (e.g.
+  // "localhost" vs. the FQDN vs. "127.0.0.1"). Fall back to matching the
+  // port under any equivalent local-host name, so colocated clients still
+  // take the zero-serialization local transfer path.
+  absl::string_view host;
+  absl::string_view port;
+  if (!SplitHostPort(worker_address, &host, &port) || !IsLocalHostName(host)) {
     return nullptr;
   }
-  return it->second;
+  for (const auto& address_and_worker : *local_workers_) {
+    absl::string_view registered_host;
+    absl::string_view registered_port;
+    if (SplitHostPort(address_and_worker.first, &registered_host,
+                      &registered_port) &&
+        registered_port == port && IsLocalHostName(registered_host)) {
+      return address_and_worker.second;
+    }
+  }
+  return nullptr;
 }
 
 bool LocalWorkers::Empty() {
@@ -16,6 +16,7 @@ limitations under the License.
 #include "tensorflow/core/data/snapshot_utils.h"
 
 #include <algorithm>
+#include <deque>
 #include <functional>
 #include <queue>
 #include <string>
@@ -436,32 +437,73 @@ class Reader::Dataset : public DatasetBase {
         : DatasetIterator<Dataset>(params),
           start_index_(dataset()->start_index_) {}
 
+    ~Iterator() override {
+      mutex_lock l(mu_);
+      cancelled_ = true;
+      cond_var_.notify_all();
+      // `prefetch_thread_` joins on destruction.
+    }
+
     Status Initialize(IteratorContext* ctx) override {
       // TODO(jsimsa): This only needs to happen when we are not restoring but
       // parallel_interleave op implementation caches IteratorContext (and thus
       // the is_restoring bit ends up being inaccurate).
+      env_ = ctx->env();
       TF_RETURN_IF_ERROR(Reader::Create(
           ctx->env(), GetCurrentFilename(), dataset()->compression_,
           dataset()->version_, dataset()->dtypes_, &reader_));
-      return AdvanceToStartIndex(ctx);
+      TF_RETURN_IF_ERROR(AdvanceToStartIndex(ctx));
+      StartPrefetchThread();
+      return Status::OK();
     }
 
    protected:
     Status GetNextInternal(IteratorContext* ctx,
                            std::vector<Tensor>* out_tensors,
                            bool* end_of_sequence) override {
+      // Elements are decoded (and decompressed) ahead of consumption by the
+      // prefetch thread; this call mostly just pops the next result, so
+      // shard decompression overlaps with downstream processing.
       *end_of_sequence = false;
-      Status s = reader_->ReadTensors(out_tensors);
-      if (!errors::IsOutOfRange(s)) {
-        start_index_++;
-        return s;
-      }
-      Status status = AdvanceToNextFile(ctx->env());
-      if (errors::IsNotFound(status)) {
-        *end_of_sequence = true;
-        return Status::OK();
+      while (true) {
+        BufferElement element;
+        {
+          mutex_lock l(mu_);
+          while (buffer_.empty() && !cancelled_) {
+            cond_var_.wait(l);
+          }
+          if (cancelled_) {
+            return errors::Cancelled("Iterator was cancelled");
+          }
+          element = std::move(buffer_.front());
+          buffer_.pop_front();
+          cond_var_.notify_all();
+        }
+        if (errors::IsOutOfRange(element.status)) {
+          // Current file is exhausted; the prefetch thread has already
+          // exited, so the reader can be advanced safely.
+          prefetch_thread_.reset();
+          Status status = AdvanceToNextFile(ctx->env());
+          if (errors::IsNotFound(status)) {
+            *end_of_sequence = true;
+            return Status::OK();
+          }
+          TF_RETURN_IF_ERROR(status);
+          StartPrefetchThread();
+          continue;
+        }
+        if (element.status.ok()) {
+          *out_tensors = std::move(element.value);
+          start_index_++;
+          return element.status;
+        }
+        // Terminal error: the prefetch thread has exited. Restart it so a
+        // subsequent call retries the read, matching the synchronous
+        // behavior.
+        prefetch_thread_.reset();
+        StartPrefetchThread();
+        return element.status;
       }
-      return status;
     }
 
     Status SaveInternal(SerializationContext* ctx,
@@ -475,6 +517,20 @@ class Reader::Dataset : public DatasetBase {
 
     Status RestoreInternal(IteratorContext* ctx,
                            IteratorStateReader* reader) override {
+      // Stop (and drain) any in-flight prefetching before replacing the
+      // reader.
+      {
+        mutex_lock l(mu_);
+        cancelled_ = true;
+        cond_var_.notify_all();
+      }
+      prefetch_thread_.reset();
+      {
+        mutex_lock l(mu_);
+        cancelled_ = false;
+        buffer_.clear();
+      }
+      env_ = ctx->env();
       TF_RETURN_IF_ERROR(reader->ReadScalar(full_name(kCurrentCheckpointID),
                                             &current_checkpoint_id_));
       TF_RETURN_IF_ERROR(
@@ -483,7 +539,9 @@ class Reader::Dataset : public DatasetBase {
       TF_RETURN_IF_ERROR(Reader::Create(
           ctx->env(), GetCurrentFilename(), dataset()->compression_,
           dataset()->version_, dataset()->dtypes_, &reader_));
-      return AdvanceToStartIndex(ctx);
+      TF_RETURN_IF_ERROR(AdvanceToStartIndex(ctx));
+      StartPrefetchThread();
+      return Status::OK();
     }
 
    private:
@@ -509,8 +567,50 @@ class Reader::Dataset : public DatasetBase {
       return Status::OK();
     }
 
+    // One pre-read element (or terminal status) produced by the prefetch
+    // thread.
+    struct BufferElement {
+      Status status;
+      std::vector<Tensor> value;
+    };
+
+    // Bounds the number of pre-read elements held in `buffer_`.
+    static constexpr size_t kPrefetchBufferSize = 8;
+
+    // Starts a thread that reads ahead from `reader_` into `buffer_` until
+    // the current file is exhausted or an error occurs; the terminal status
+    // is pushed as the last buffer element and the thread exits. The reader
+    // is only touched by the prefetch thread while it is alive.
+    void StartPrefetchThread() {
+      prefetch_thread_.reset(env_->StartThread(
+          {}, "tf_data_snapshot_read", [this]() { PrefetchLoop(); }));
+    }
+
+    void PrefetchLoop() {
+      while (true) {
+        BufferElement element;
+        element.status = reader_->ReadTensors(&element.value);
+        const bool done = !element.status.ok();
+        mutex_lock l(mu_);
+        while (buffer_.size() >= kPrefetchBufferSize && !cancelled_) {
+          cond_var_.wait(l);
+        }
+        if (cancelled_) return;
+        buffer_.push_back(std::move(element));
+        cond_var_.notify_all();
+        if (done) return;
+      }
+    }
+
     std::unique_ptr<Reader> reader_;
 
+    Env* env_ = nullptr;
+    mutex mu_;
+    condition_variable cond_var_;
+    std::deque<BufferElement> buffer_ TF_GUARDED_BY(mu_);
+    bool cancelled_ TF_GUARDED_BY(mu_) = false;
+    std::unique_ptr<Thread> prefetch_thread_;
+
     // Stores the id current checkpoint file that we are in the process of
     // reading (e.g. if the file is currently 00000001.snapshot, then this will
     // be 1).
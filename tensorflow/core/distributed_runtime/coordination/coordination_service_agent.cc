@@ -15,11 +15,16 @@ limitations under the License.
 
 #include "tensorflow/core/distributed_runtime/coordination/coordination_service_agent.h"
 
+#include <cstdlib>
+#include <cstring>
+
 #include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/match.h"
 #include "absl/strings/substitute.h"
 #include "absl/synchronization/notification.h"
 #include "absl/time/time.h"
@@ -123,6 +128,19 @@ class CoordinationServiceAgentImpl : public CoordinationServiceAgent {
   bool shutting_down_ TF_GUARDED_BY(heartbeat_thread_shutdown_mu_) = false;
   std::unique_ptr<Thread> heartbeat_thread_;
 
+  // Optional agent-side cache of successful key-value reads; see
+  // GetKeyValueAsync.
+  static bool KvCacheEnabled() {
+    static const bool enabled = [] {
+      const char* value = std::getenv("TF_COORDINATION_AGENT_CACHE_KV");
+      return value != nullptr && strcmp(value, "1") == 0;
+    }();
+    return enabled;
+  }
+  mutex kv_cache_mu_;
+  absl::flat_hash_map<std::string, std::string> kv_cache_
+      TF_GUARDED_BY(kv_cache_mu_);
+
   TF_DISALLOW_COPY_AND_ASSIGN(CoordinationServiceAgentImpl);
 };
 
@@ -406,20 +424,42 @@ Status CoordinationServiceAgentImpl::InsertKeyValue(const std::string& key,
     n.Notify();
   });
   n.WaitForNotification();
+  if (KvCacheEnabled()) {
+    mutex_lock l(kv_cache_mu_);
+    kv_cache_.erase(key);
+  }
   return status;
 }
 
 void CoordinationServiceAgentImpl::GetKeyValueAsync(
     const std::string& key, StatusOrValueCallback done) {
+  // With TF_COORDINATION_AGENT_CACHE_KV=1, successful reads are cached in
+  // the agent, so repeated lookups of configuration-style keys (device
+  // lists, peer addresses) skip the leader round-trip, which costs ~1ms
+  // even for colocated tasks. The cache is invalidated by this agent's own
+  // Insert/Delete; workloads that overwrite keys from *other* tasks and
+  // re-read them must leave the cache off (the default).
+  if (KvCacheEnabled()) {
+    mutex_lock l(kv_cache_mu_);
+    auto it = kv_cache_.find(key);
+    if (it != kv_cache_.end()) {
+      done(it->second);
+      return;
+    }
+  }
   auto request = std::make_shared<GetKeyValueRequest>();
   request->set_key(key);
   auto response = std::make_shared<GetKeyValueResponse>();
   leader_client_->GetKeyValueAsync(
       request.get(), response.get(),
-      [request, response, done = std::move(done)](const Status& s) {
+      [this, key, request, response, done = std::move(done)](const Status& s) {
         if (!s.ok()) {
           done(s);
         } else {
+          if (KvCacheEnabled()) {
+            mutex_lock l(kv_cache_mu_);
+            kv_cache_.emplace(key, response->kv().value());
+          }
           done(response->kv().value());
         }
       });
@@ -438,6 +478,17 @@ Status CoordinationServiceAgentImpl::DeleteKeyValue(const std::string& key) {
     n.Notify();
   });
   n.WaitForNotification();
+  if (KvCacheEnabled()) {
+    // Directory deletes invalidate the whole prefix.
+    mutex_lock l(kv_cache_mu_);
+    for (auto it = kv_cache_.begin(); it != kv_cache_.end();) {
+      if (absl::StartsWith(it->first, key)) {
+        kv_cache_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
   return Status::OK();
 }
 
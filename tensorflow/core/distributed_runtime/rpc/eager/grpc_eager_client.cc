@@ -15,6 +15,11 @@ limitations under the License.
 
 #include "tensorflow/core/distributed_runtime/rpc/eager/grpc_eager_client.h"
 
+#include <cstdlib>
+
+#include "tensorflow/core/lib/strings/numbers.h"
+#include <vector>
+
 #include "grpcpp/generic/generic_stub.h"
 #include "tensorflow/core/distributed_runtime/call_options.h"
 #include "tensorflow/core/distributed_runtime/rpc/eager/grpc_eager_service.h"
@@ -176,6 +181,25 @@ class GrpcEagerClient : public EagerClient {
     }
   }
 
+  // When TF_EAGER_ENQUEUE_COALESCE_MICROS is set to a positive value,
+  // streaming enqueues buffer for up to that long and ship as one merged
+  // EnqueueRequest per context, amortizing the per-message overhead for
+  // workloads that issue thousands of tiny remote ops per second. Responses
+  // are split back to the original callers in order (EnqueueResponse items
+  // parallel the request's queue items).
+  static int64_t CoalesceWindowMicros() {
+    static const int64_t micros = [] {
+      int64_t value = 0;
+      const char* env = std::getenv("TF_EAGER_ENQUEUE_COALESCE_MICROS");
+      if (env != nullptr && !strings::safe_strto64(env, &value)) {
+        LOG(WARNING) << "Invalid TF_EAGER_ENQUEUE_COALESCE_MICROS: " << env;
+        value = 0;
+      }
+      return value;
+    }();
+    return micros;
+  }
+
   void StreamingEnqueueAsync(CallOptions* call_opts,
                              const EnqueueRequest* request,
                              EnqueueResponse* response,
@@ -193,6 +217,10 @@ class GrpcEagerClient : public EagerClient {
                 "/tensorflow.eager.EagerService/StreamingEnqueue"));
         it = it_and_bool.first;
       }
+      if (CoalesceWindowMicros() > 0) {
+        CoalesceLocked(request, response, std::move(done_wrapped));
+        return;
+      }
       // TODO(haoyuzhang): Consider supporting cancellation for streaming RPC?
       it->second.SendNextRequest(*request, response, std::move(done_wrapped));
     } else {
@@ -220,6 +248,84 @@ class GrpcEagerClient : public EagerClient {
   std::unordered_map<uint64, StreamingRPCDispatcher<EnqueueResponse>>
       enqueue_dispatchers_ TF_GUARDED_BY(mu_);
 
+  // One caller's share of a coalesced enqueue.
+  struct PendingCaller {
+    int num_items;
+    EnqueueResponse* response;
+    StatusCallback done;
+  };
+  // Items and callers buffered during the coalescing window, per context.
+  struct PendingEnqueue {
+    EnqueueRequest merged;
+    std::vector<PendingCaller> callers;
+    bool flush_scheduled = false;
+  };
+  std::unordered_map<uint64, PendingEnqueue> pending_enqueues_
+      TF_GUARDED_BY(mu_);
+
+  void CoalesceLocked(const EnqueueRequest* request, EnqueueResponse* response,
+                      StatusCallback done) TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    PendingEnqueue& pending = pending_enqueues_[request->context_id()];
+    pending.merged.set_context_id(request->context_id());
+    for (const auto& item : request->queue()) {
+      *pending.merged.add_queue() = item;
+    }
+    pending.callers.push_back(
+        {request->queue_size(), response, std::move(done)});
+    if (!pending.flush_scheduled) {
+      pending.flush_scheduled = true;
+      Ref();
+      uint64 context_id = request->context_id();
+      Env::Default()->SchedClosureAfter(
+          CoalesceWindowMicros(), [this, context_id]() {
+            FlushCoalesced(context_id);
+            Unref();
+          });
+    }
+  }
+
+  void FlushCoalesced(uint64 context_id) {
+    EnqueueRequest merged;
+    std::vector<PendingCaller> callers;
+    StreamingRPCDispatcher<EnqueueResponse>* dispatcher = nullptr;
+    auto merged_response = std::make_shared<EnqueueResponse>();
+    {
+      mutex_lock l(mu_);
+      auto it = pending_enqueues_.find(context_id);
+      if (it == pending_enqueues_.end()) return;
+      merged = std::move(it->second.merged);
+      callers = std::move(it->second.callers);
+      pending_enqueues_.erase(it);
+      auto dispatcher_it = enqueue_dispatchers_.find(context_id);
+      if (dispatcher_it == enqueue_dispatchers_.end()) {
+        // Context was closed while the flush was pending.
+        for (PendingCaller& caller : callers) {
+          caller.done(errors::Unavailable(
+              "Remote EagerContext with id ", context_id, " closed."));
+        }
+        return;
+      }
+      dispatcher = &dispatcher_it->second;
+      dispatcher->SendNextRequest(
+          merged, merged_response.get(),
+          [merged_response, callers](const Status& status) mutable {
+            // Split the merged response back to the callers, in order.
+            int next_item = 0;
+            for (PendingCaller& caller : callers) {
+              if (status.ok()) {
+                for (int i = 0; i < caller.num_items &&
+                                next_item < merged_response->queue_response_size();
+                     ++i, ++next_item) {
+                  *caller.response->add_queue_response() =
+                      merged_response->queue_response(next_item);
+                }
+              }
+              caller.done(status);
+            }
+          });
+    }
+  }
+
   StatusCallback callback_wrapper(StatusCallback done) {
     Ref();
     return [this, done = std::move(done)](const Status& status) {
@@ -110,6 +110,26 @@ const ::grpc::ChannelArguments* GetDefaultChannelArguments() {
   // NOTE(mrry): Some versions of gRPC use a 20-second minimum backoff
   // on connection failure, which makes our tests time out.
   args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, 1000);
+  // On high bandwidth-delay-product networks, gRPC's default HTTP/2 flow
+  // control windows cap single-stream (and therefore single-tensor)
+  // throughput well below line rate. TF_GRPC_STREAM_WINDOW_BYTES widens both
+  // the per-stream and connection windows (BDP probing is disabled when the
+  // window is pinned explicitly, which keeps the setting authoritative).
+  {
+    static const int64_t stream_window_bytes = [] {
+      int64_t value = 0;
+      const char* env = std::getenv("TF_GRPC_STREAM_WINDOW_BYTES");
+      if (env != nullptr && !strings::safe_strto64(env, &value)) {
+        LOG(ERROR) << "Invalid TF_GRPC_STREAM_WINDOW_BYTES: " << env;
+        value = 0;
+      }
+      return value;
+    }();
+    if (stream_window_bytes > 0) {
+      args.SetInt(GRPC_ARG_HTTP2_STREAM_LOOKAHEAD_BYTES, stream_window_bytes);
+      args.SetInt(GRPC_ARG_HTTP2_WRITE_BUFFER_SIZE, stream_window_bytes);
+    }
+  }
   if (rpc_options != nullptr) {
     if (rpc_options->compression_algorithm() == "deflate") {
       args.SetCompressionAlgorithm(GRPC_COMPRESS_DEFLATE);
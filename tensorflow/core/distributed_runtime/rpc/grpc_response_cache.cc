@@ -14,6 +14,10 @@ limitations under the License.
 ==============================================================================*/
 
 #include "tensorflow/core/distributed_runtime/rpc/grpc_response_cache.h"
+
+#include <cstdlib>
+
+#include "tensorflow/core/lib/strings/numbers.h"
 #include "absl/types/optional.h"
 #include "tensorflow/core/platform/env.h"
 
@@ -29,6 +33,7 @@ bool GrpcResponseCache::QueueRequest(int64_t request_id, int64_t step_id,
 
   if (entry.state == ResponseCacheEntry::State::FINISHED) {
     VLOG(1) << "Reuse cached response for " << request_id;
+    entry.lru_seq = ++lru_tick_;
     // Make a copy of the ResponseCacheEntry so that we can run FinishResponse
     // outside the critical section. FinishResponse can be potentially
     // expensive.
@@ -80,6 +85,10 @@ void GrpcResponseCache::OnRequestFinished(int64_t request_id,
     entry.is_dead = is_dead;
     entry.response_status = status;
     entry.state = ResponseCacheEntry::State::FINISHED;
+    entry.bytes = static_cast<int64_t>(tensor.TotalBytes());
+    entry.lru_seq = ++lru_tick_;
+    finished_bytes_ += entry.bytes;
+    MaybeEvictLocked();
 
     // We copy the extra work out of the critical section in order to avoid
     // serializing the work for sending response.
@@ -95,7 +104,43 @@ void GrpcResponseCache::OnRequestFinished(int64_t request_id,
 
 void GrpcResponseCache::EraseRequestId(int64_t request_id) {
   mutex_lock m(mu_);
-  response_cache_.erase(request_id);
+  auto it = response_cache_.find(request_id);
+  if (it != response_cache_.end()) {
+    if (it->second.state == ResponseCacheEntry::State::FINISHED) {
+      finished_bytes_ -= it->second.bytes;
+    }
+    response_cache_.erase(it);
+  }
+}
+
+void GrpcResponseCache::MaybeEvictLocked() {
+  static const int64_t budget_bytes = [] {
+    int64_t value = 0;  // 0 = unlimited, preserving historical behavior.
+    const char* env = std::getenv("TF_GRPC_RESPONSE_CACHE_BYTES");
+    if (env != nullptr && !strings::safe_strto64(env, &value)) {
+      LOG(WARNING) << "Invalid TF_GRPC_RESPONSE_CACHE_BYTES: " << env;
+      value = 0;
+    }
+    return value;
+  }();
+  if (budget_bytes <= 0) return;
+  while (finished_bytes_ > budget_bytes) {
+    // Find the least recently used FINISHED entry. The cache is small (it
+    // drains on acks), so a linear scan beats maintaining a heap.
+    auto victim = response_cache_.end();
+    for (auto it = response_cache_.begin(); it != response_cache_.end(); ++it) {
+      if (it->second.state == ResponseCacheEntry::State::FINISHED &&
+          (victim == response_cache_.end() ||
+           it->second.lru_seq < victim->second.lru_seq)) {
+        victim = it;
+      }
+    }
+    if (victim == response_cache_.end()) return;
+    VLOG(1) << "Evicting response cache entry " << victim->first << " ("
+            << victim->second.bytes << " bytes) to fit budget";
+    finished_bytes_ -= victim->second.bytes;
+    response_cache_.erase(victim);
+  }
 }
 
 void GrpcResponseCache::CleanEntriesForStep(int64_t step_id) {
@@ -105,6 +150,9 @@ void GrpcResponseCache::CleanEntriesForStep(int64_t step_id) {
        it != last;) {
     if (it->second.step_id == step_id) {
       VLOG(1) << "Erase stale GrpcResponseCache entry " << it->first;
+      if (it->second.state == ResponseCacheEntry::State::FINISHED) {
+        finished_bytes_ -= it->second.bytes;
+      }
       it = response_cache_.erase(it);
     } else {
       ++it;
@@ -77,6 +77,10 @@ class GrpcResponseCache {
     Tensor tensor;
     bool is_dead = false;
     Status response_status;
+    // Approximate bytes retained by a FINISHED entry, and its last-use tick
+    // for bytes-budget eviction.
+    int64_t bytes = 0;
+    int64_t lru_seq = 0;
 
     void FinishResponse(const FinishResponseCB& cb) const {
       cb(tensor, is_dead, response_status);
@@ -84,10 +88,20 @@ class GrpcResponseCache {
     std::vector<FinishResponseCB> callbacks;
   };
 
+  // Evicts least-recently-used FINISHED entries (those only held for
+  // duplicate-request replay) until the retained bytes fit the budget given
+  // by TF_GRPC_RESPONSE_CACHE_BYTES. A request whose entry was evicted is
+  // treated like one whose ack was lost: a retry re-executes instead of
+  // replaying, which bounds memory instead of letting large RecvTensor
+  // responses accumulate until step cleanup.
+  void MaybeEvictLocked() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   mutex mu_;
   // response_cache_ is expected to be small, as entries are cleared immediately
   // on ack from the receiver.
   gtl::FlatMap<int64_t, ResponseCacheEntry> response_cache_ TF_GUARDED_BY(mu_);
+  int64_t finished_bytes_ TF_GUARDED_BY(mu_) = 0;
+  int64_t lru_tick_ TF_GUARDED_BY(mu_) = 0;
 };
 
 }  // namespace tensorflow
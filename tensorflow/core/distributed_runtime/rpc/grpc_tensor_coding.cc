@@ -15,6 +15,10 @@ limitations under the License.
 
 #include "tensorflow/core/distributed_runtime/rpc/grpc_tensor_coding.h"
 
+#include <cstdlib>
+
+#include "tensorflow/core/lib/strings/numbers.h"
+
 #include "grpcpp/support/byte_buffer.h"
 #include "grpcpp/support/slice.h"
 #include "tensorflow/core/common_runtime/dma_helper.h"
@@ -134,9 +138,30 @@ static void EncodeSkeleton(const Tensor& val, io::ProtoEncodeHelper* e) {
 #endif
 }
 
+// Tensors whose payload exceeds this many bytes are aliased into the gRPC
+// byte buffer (with a deleter holding a TensorBuffer reference) instead of
+// being copied. Overridable via TF_GRPC_TENSOR_ALIAS_THRESHOLD_BYTES, e.g.
+// to alias smaller tensors on copy-bound links or to force copying (a large
+// value) when aliasing pins buffers too long.
+static int64_t AliasThresholdBytes() {
+  static const int64_t threshold = [] {
+    int64_t value = 1024;
+    const char* env = std::getenv("TF_GRPC_TENSOR_ALIAS_THRESHOLD_BYTES");
+    if (env != nullptr) {
+      if (!strings::safe_strto64(env, &value) || value < 0) {
+        LOG(WARNING) << "Invalid TF_GRPC_TENSOR_ALIAS_THRESHOLD_BYTES: "
+                     << env;
+        value = 1024;
+      }
+    }
+    return value;
+  }();
+  return threshold;
+}
+
 void EncodeTensorToByteBuffer(bool is_dead, const Tensor& val, bool require_ack,
                               ::grpc::ByteBuffer* result) {
-  const int kLargeTensorBytes = 1024;
+  const int64_t kLargeTensorBytes = AliasThresholdBytes();
   const int64_t kProtoBufLimitBytes = 1LL << 31;
 
   if (val.TotalBytes() > kProtoBufLimitBytes) {
@@ -189,7 +214,8 @@ void EncodeTensorToByteBuffer(bool is_dead, const Tensor& val, bool require_ack,
     // backing store alive as needed.
     //
     // We enable this behavior if the tensor is large.
-    bool share_tensor_slice_memory = (tdata.size() > kLargeTensorBytes);
+    bool share_tensor_slice_memory =
+        (static_cast<int64_t>(tdata.size()) > kLargeTensorBytes);
 
     size_t encoder_size = expected_size - tdata.size();
 
@@ -19,6 +19,7 @@ limitations under the License.
 #include "tensorflow/core/framework/types.h"
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/notification.h"
+#include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/lib/gtl/manual_constructor.h"
 #include "tensorflow/core/lib/monitoring/counter.h"
 #include "tensorflow/core/lib/strings/numbers.h"
@@ -113,13 +114,13 @@ LocalRendezvous::~LocalRendezvous() {
 }
 
 namespace {
-uint64 KeyHash(const StringPiece& k) { return Hash64(k.data(), k.size()); }
+uint64 KeyHash(const Rendezvous::ParsedKey& k) { return k.FullKeyHash(); }
 }  // namespace
 
 Status LocalRendezvous::Send(const Rendezvous::ParsedKey& key,
                              const Rendezvous::Args& send_args,
                              const Tensor& val, const bool is_dead) {
-  uint64 key_hash = KeyHash(key.FullKey());
+  uint64 key_hash = KeyHash(key);
   DVLOG(2) << "Send " << this << " " << key_hash << " " << key.FullKey();
 
   if (is_dead) {
@@ -190,10 +191,102 @@ Status LocalRendezvous::Send(const Rendezvous::ParsedKey& key,
   return Status::OK();
 }
 
+Status LocalRendezvous::SendBatch(
+    gtl::ArraySlice<Rendezvous::BatchedSend> sends) {
+  if (sends.empty()) return Status::OK();
+
+  // Precompute key hashes and allocate the Item storage for the
+  // no-waiter-yet case outside the lock, so the critical section is reduced
+  // to the table operations themselves.
+  gtl::InlinedVector<uint64, 8> key_hashes;
+  key_hashes.reserve(sends.size());
+  gtl::InlinedVector<Item*, 8> send_items;
+  send_items.reserve(sends.size());
+  for (const Rendezvous::BatchedSend& send : sends) {
+    key_hashes.push_back(KeyHash(*send.key));
+    send_items.push_back(new Item(send.args, *send.val, send.is_dead));
+    if (TF_PREDICT_FALSE(send.is_dead)) {
+      static auto* rendezvous_dead_values_sent = monitoring::Counter<2>::New(
+          "/tensorflow/core/rendezvous_dead_values_sent",
+          "The number of dead values sent between a pair of devices.",
+          "send_device", "recv_device");
+      rendezvous_dead_values_sent
+          ->GetCell(string(send.key->src_device), string(send.key->dst_device))
+          ->IncrementBy(1);
+    }
+  }
+
+  // Waiters matched under the lock; their callbacks run after it is released.
+  struct MatchedRecv {
+    Item* item;
+    size_t send_index;
+  };
+  gtl::InlinedVector<MatchedRecv, 8> matched;
+
+  mu_.lock();
+  if (!status_.ok()) {
+    // Rendezvous has been aborted.
+    Status s = status_;
+    mu_.unlock();
+    for (Item* item : send_items) delete item;
+    return s;
+  }
+
+  for (size_t i = 0; i < sends.size(); ++i) {
+    ItemQueue* queue = &table_[key_hashes[i]];
+    if (queue->head == nullptr || queue->head->type == Item::kSend) {
+      // No waiter for this message yet; append it for later pickup.
+      queue->push_back(send_items[i]);
+      send_items[i] = nullptr;
+      continue;
+    }
+
+    // There is an earliest waiter to consume this message.
+    Item* item = queue->head;
+    if (item->next == nullptr) {
+      table_.erase(key_hashes[i]);
+    } else {
+      queue->head = item->next;
+    }
+    matched.push_back({item, i});
+  }
+
+  core::RefCountPtr<const Rendezvous> rc_owner_ref;
+  if (!matched.empty()) {
+    // See the comment in Send(): keep the rendezvous alive while the
+    // done-callbacks are running.
+    if (rc_owner_) {
+      rc_owner_ref.reset(rc_owner_);
+      rc_owner_->Ref();
+    }
+    pending_callback_counter_ += matched.size();
+  }
+  mu_.unlock();
+
+  // Invoke the done-callbacks of all matched waiters, without holding the
+  // lock, then retire the Items that found no waiter.
+  for (const MatchedRecv& m : matched) {
+    DCHECK_EQ(m.item->type, Item::kRecv);
+    const Rendezvous::BatchedSend& send = sends[m.send_index];
+    (*m.item->recv_state.waiter)(Status::OK(), send.args, m.item->args,
+                                 *send.val, send.is_dead);
+    delete m.item;
+    delete send_items[m.send_index];
+  }
+  if (!matched.empty()) {
+    mutex_lock l(mu_);
+    pending_callback_counter_ -= matched.size();
+    if (pending_callback_counter_ == 0) {
+      pending_callback_cond_var_.notify_all();
+    }
+  }
+  return Status::OK();
+}
+
 void LocalRendezvous::RecvAsync(const Rendezvous::ParsedKey& key,
                                 const Rendezvous::Args& recv_args,
                                 Rendezvous::DoneCallback done) {
-  uint64 key_hash = KeyHash(key.FullKey());
+  uint64 key_hash = KeyHash(key);
   DVLOG(2) << "Recv " << this << " " << key_hash << " " << key.FullKey();
 
   mu_.lock();
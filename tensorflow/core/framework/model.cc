@@ -955,6 +955,45 @@ class Unknown : public Node {
   }
 };
 
+// Process-wide arbiter for autotune buffer growth. Each Model enforces its
+// own ram budget below, but concurrent input pipelines each believe they own
+// that budget; the arbiter adds shared accounting of all models'
+// reservations plus an allocator-pressure check, denying growth when the
+// combined reservations would exceed the budget share of the memory that is
+// actually still free on the host.
+class BufferedBytesArbiter {
+ public:
+  static BufferedBytesArbiter* Global() {
+    static BufferedBytesArbiter* arbiter = new BufferedBytesArbiter;
+    return arbiter;
+  }
+
+  bool TryAllocate(double delta) {
+    mutex_lock l(mu_);
+    const double free_memory =
+        static_cast<double>(port::GetMemoryInfo().free);
+    // Memory already reserved by models is (mostly) allocated and therefore
+    // no longer "free"; count it back into the shared pot so that a model
+    // is not penalized for its own reservations.
+    if (total_reserved_ + delta >
+        kRamBudgetShare * (free_memory + total_reserved_)) {
+      return false;
+    }
+    total_reserved_ += delta;
+    return true;
+  }
+
+  void Release(double bytes) {
+    mutex_lock l(mu_);
+    total_reserved_ -= bytes;
+  }
+
+ private:
+  mutex mu_;
+  double total_reserved_ TF_GUARDED_BY(mu_) = 0;
+};
+
+
 }  // namespace
 
 thread_local int64_t Node::work_start_;
@@ -1643,6 +1682,15 @@ Model::~Model() {
   // prevent race condition where the gauge callback is called after the Model
   // is destroyed.
   model_gauge_cell_->Set([]() { return std::string(); });
+  // Return this model's buffer reservations to the process-wide pot.
+  double reserved;
+  {
+    mutex_lock l(mu_);
+    reserved = maximum_buffered_bytes_;
+  }
+  if (reserved > 0) {
+    BufferedBytesArbiter::Global()->Release(reserved);
+  }
 }
 
 void Model::AddNode(Node::Factory factory, const string& name,
@@ -1772,11 +1820,14 @@ bool Model::AllocateBufferedBytes(double delta) {
   if (budget_params_.autotune_ram_budget <= 0) {
     return true;
   }
-  if (maximum_buffered_bytes_ + delta <= budget_params_.autotune_ram_budget) {
-    maximum_buffered_bytes_ += delta;
-    return true;
+  if (maximum_buffered_bytes_ + delta > budget_params_.autotune_ram_budget) {
+    return false;
   }
-  return false;
+  if (!BufferedBytesArbiter::Global()->TryAllocate(delta)) {
+    return false;
+  }
+  maximum_buffered_bytes_ += delta;
+  return true;
 }
 
 // TODO(jsimsa): Add support for tracking and using the model input time.
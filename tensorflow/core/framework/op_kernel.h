@@ -1710,6 +1710,104 @@ inline void CheckNotInComputeAsync(OpKernelConstruction*, const char*) {}
 void CheckNotInComputeAsync(OpKernelContext* ctx,
                             const char* correct_macro_name);
 
+// A per-kernel-instance pool for temporary scratch buffers.
+//
+// Kernels that call allocate_temp for scratch on every invocation round-trip
+// the allocator each step. A kernel can instead hold a ScratchBufferPool
+// member and obtain its scratch through Get(): the backing allocation is
+// retained at its high-water size across invocations, so steady-state calls
+// with stable shapes perform no allocations at all.
+//
+// Concurrency: a kernel instance may run concurrently in several executors.
+// The pool hands its retained buffer to one invocation at a time; while it
+// is checked out, other invocations transparently fall back to a fresh
+// allocate_temp, preserving correctness at the cost of the allocation.
+//
+// Only memcpy-able dtypes are eligible (the buffer is recycled as raw
+// bytes); other dtypes always fall back to allocate_temp.
+class ScratchBufferPool {
+ public:
+  // RAII handle to a scratch tensor. The tensor is valid for the lifetime of
+  // the handle; destroying the handle returns the retained buffer (if used)
+  // to the pool.
+  class ScopedScratch {
+   public:
+    ScopedScratch() = default;
+    ScopedScratch(ScopedScratch&& other)
+        : pool_(other.pool_), tensor_(std::move(other.tensor_)) {
+      other.pool_ = nullptr;
+    }
+    ScopedScratch& operator=(ScopedScratch&& other) {
+      Release();
+      pool_ = other.pool_;
+      tensor_ = std::move(other.tensor_);
+      other.pool_ = nullptr;
+      return *this;
+    }
+    ~ScopedScratch() { Release(); }
+
+    Tensor* tensor() { return &tensor_; }
+
+   private:
+    friend class ScratchBufferPool;
+
+    void Release() {
+      if (pool_ != nullptr) {
+        tensor_ = Tensor();
+        pool_->busy_.clear(std::memory_order_release);
+        pool_ = nullptr;
+      }
+    }
+
+    ScratchBufferPool* pool_ = nullptr;  // Set iff the retained buffer is used.
+    Tensor tensor_;
+  };
+
+  // Points `*scratch` at a tensor of `dtype`/`shape` suitable for temporary
+  // use, backed by the pool's retained buffer when it is available and large
+  // enough (growing it if needed), and by a fresh temp allocation otherwise.
+  Status Get(OpKernelContext* ctx, DataType dtype, const TensorShape& shape,
+             ScopedScratch* scratch) {
+    if (!DataTypeCanUseMemcpy(dtype) ||
+        busy_.test_and_set(std::memory_order_acquire)) {
+      return AllocateFallback(ctx, dtype, shape, scratch);
+    }
+    const int64_t bytes = shape.num_elements() * DataTypeSize(dtype);
+    if (buffer_.NumElements() < bytes) {
+      // Grow to the new high-water mark.
+      Status status = ctx->allocate_temp(DT_UINT8, TensorShape({bytes}),
+                                         &buffer_);
+      if (!status.ok()) {
+        busy_.clear(std::memory_order_release);
+        return status;
+      }
+    }
+    Status status = scratch->tensor_.BitcastFrom(
+        buffer_.NumElements() == bytes ? buffer_
+                                       : buffer_.Slice(0, bytes),
+        dtype, shape);
+    if (!status.ok()) {
+      busy_.clear(std::memory_order_release);
+      return status;
+    }
+    scratch->pool_ = this;
+    return Status::OK();
+  }
+
+ private:
+  static Status AllocateFallback(OpKernelContext* ctx, DataType dtype,
+                                 const TensorShape& shape,
+                                 ScopedScratch* scratch) {
+    scratch->pool_ = nullptr;
+    return ctx->allocate_temp(dtype, shape, &scratch->tensor_);
+  }
+
+  std::atomic_flag busy_ = ATOMIC_FLAG_INIT;
+  // Retained high-water backing store, recycled as raw bytes. Only touched
+  // by the invocation that owns `busy_`.
+  Tensor buffer_;
+};
+
 }  // namespace tensorflow
 
 #endif  // TENSORFLOW_CORE_FRAMEWORK_OP_KERNEL_H_
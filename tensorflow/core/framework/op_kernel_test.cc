@@ -385,6 +385,60 @@ TEST_F(OpKernelTest, InputDtype) {
   EXPECT_EQ(dtype, DT_INT32);
 }
 
+TEST_F(OpKernelTest, ScratchBufferPool) {
+  Env* env = Env::Default();
+  OpKernelContext::Params params;
+  DummyDevice device(env);
+  params.device = &device;
+  Status status;
+  std::unique_ptr<OpKernel> op(
+      CreateOpKernel(DEVICE_CPU, params.device, cpu_allocator(),
+                     CreateNodeDef("Test1", {DT_FLOAT, DT_INT32}),
+                     TF_GRAPH_DEF_VERSION, &status));
+  TF_ASSERT_OK(status);
+  params.op_kernel = op.get();
+  gtl::InlinedVector<TensorValue, 4> inputs{};
+  params.inputs = &inputs;
+  OpKernelContext ctx(&params);
+
+  ScratchBufferPool pool;
+  const TensorShape shape({16, 4});
+  const void* retained_data = nullptr;
+  {
+    ScratchBufferPool::ScopedScratch scratch;
+    TF_ASSERT_OK(pool.Get(&ctx, DT_FLOAT, shape, &scratch));
+    ASSERT_EQ(scratch.tensor()->shape(), shape);
+    scratch.tensor()->flat<float>().setZero();
+    retained_data = scratch.tensor()->tensor_data().data();
+
+    // While the retained buffer is checked out, a concurrent request falls
+    // back to a fresh temp allocation instead of aliasing it.
+    ScratchBufferPool::ScopedScratch concurrent;
+    TF_ASSERT_OK(pool.Get(&ctx, DT_FLOAT, shape, &concurrent));
+    ASSERT_EQ(concurrent.tensor()->shape(), shape);
+    EXPECT_NE(concurrent.tensor()->tensor_data().data(), retained_data);
+  }
+  {
+    // After release, an equal-sized request reuses the retained buffer.
+    ScratchBufferPool::ScopedScratch scratch;
+    TF_ASSERT_OK(pool.Get(&ctx, DT_FLOAT, shape, &scratch));
+    EXPECT_EQ(scratch.tensor()->tensor_data().data(), retained_data);
+  }
+  {
+    // A larger request grows the retained buffer to the new high-water mark.
+    ScratchBufferPool::ScopedScratch scratch;
+    TF_ASSERT_OK(pool.Get(&ctx, DT_FLOAT, TensorShape({32, 4}), &scratch));
+    EXPECT_EQ(scratch.tensor()->shape(), TensorShape({32, 4}));
+  }
+  {
+    // Non-memcpy dtypes always use the fallback.
+    ScratchBufferPool::ScopedScratch scratch;
+    TF_ASSERT_OK(pool.Get(&ctx, DT_STRING, TensorShape({4}), &scratch));
+    EXPECT_EQ(scratch.tensor()->NumElements(), 4);
+    EXPECT_EQ(scratch.tensor()->dtype(), DT_STRING);
+  }
+}
+
 // A mock device that mimics the behavior of scoped allocator upon calling
 // GetAllocator with a positive scope_id.
 class ScopedAllocatorDevice : public DeviceBase {
@@ -47,6 +47,8 @@ Rendezvous::ParsedKey& Rendezvous::ParsedKey::operator=(const ParsedKey& b) {
   dst = b.dst;
   edge_name = StringPiece(buf_.data() + (b.edge_name.data() - b_base),
                           b.edge_name.size());
+  cached_hash_.store(b.cached_hash_.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed);
   return *this;
 }
 
@@ -86,6 +88,8 @@ static StringPiece ConsumeNextPart(StringPiece* s, char delim) {
 
 /* static */
 Status Rendezvous::ParseKey(StringPiece key, ParsedKey* out) {
+  // The key bytes are (re)assigned below; any memoized hash is stale.
+  out->cached_hash_.store(0, std::memory_order_relaxed);
   if (key.data() == out->buf_.data()) {
     // Caller used our buf_ string directly, so we don't need to copy.  (The
     // SendOp and RecvOp implementations do this, for example).
@@ -149,6 +153,13 @@ Status RendezvousInterface::Recv(const ParsedKey& key, const Args& args,
   return Recv(key, args, val, is_dead, no_timeout);
 }
 
+Status RendezvousInterface::SendBatch(gtl::ArraySlice<BatchedSend> sends) {
+  for (const BatchedSend& send : sends) {
+    TF_RETURN_IF_ERROR(Send(*send.key, send.args, *send.val, send.is_dead));
+  }
+  return Status::OK();
+}
+
 namespace {
 class LocalRendezvousWrapper : public Rendezvous {
  public:
@@ -159,6 +170,10 @@ class LocalRendezvousWrapper : public Rendezvous {
     return impl_.Send(key, send_args, val, is_dead);
   }
 
+  Status SendBatch(gtl::ArraySlice<BatchedSend> sends) override {
+    return impl_.SendBatch(sends);
+  }
+
   void RecvAsync(const ParsedKey& key, const Args& recv_args,
                  DoneCallback done) override {
     impl_.RecvAsync(key, recv_args, std::move(done));
@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_FRAMEWORK_RENDEZVOUS_H_
 #define TENSORFLOW_CORE_FRAMEWORK_RENDEZVOUS_H_
 
+#include <atomic>
 #include <string>
 
 #include "tensorflow/core/framework/cancellation.h"
@@ -23,6 +24,8 @@ limitations under the License.
 #include "tensorflow/core/framework/device_base.h"
 #include "tensorflow/core/framework/tensor.h"
 #include "tensorflow/core/lib/core/refcount.h"
+#include "tensorflow/core/lib/hash/hash.h"
+#include "tensorflow/core/lib/gtl/array_slice.h"
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/util/device_name_utils.h"
 
@@ -70,11 +73,26 @@ class RendezvousInterface {
     ParsedKey& operator=(const ParsedKey& b);
     StringPiece FullKey() const { return buf_; }
 
+    // Returns (memoizing on first use) the hash of FullKey(). Send/Recv
+    // kernels keep their ParsedKey across steps for static edges, so the
+    // rendezvous table hash of the ~100-byte key string is computed once per
+    // edge instead of once per transfer. Relaxed atomics: concurrent callers
+    // compute and store the same value.
+    uint64 FullKeyHash() const {
+      uint64 hash = cached_hash_.load(std::memory_order_relaxed);
+      if (hash == 0) {
+        hash = Hash64(buf_.data(), buf_.size());
+        cached_hash_.store(hash, std::memory_order_relaxed);
+      }
+      return hash;
+    }
+
    private:
     friend class Rendezvous;
     friend class SendOp;
     friend class RecvOp;
     std::string buf_;
+    mutable std::atomic<uint64> cached_hash_{0};
   };
 
   // The caller is a tensor producer and it sends a message (a tensor
@@ -91,6 +109,22 @@ class RendezvousInterface {
   virtual Status Send(const ParsedKey& key, const Args& args, const Tensor& val,
                       const bool is_dead) = 0;
 
+  // One element of a SendBatch() call. All pointers must remain valid for the
+  // duration of the call.
+  struct BatchedSend {
+    const ParsedKey* key;
+    Args args;
+    const Tensor* val;
+    bool is_dead = false;
+  };
+
+  // Sends all of `sends` as one operation where the implementation supports
+  // it (e.g. a whole graph-partition boundary's worth of tensors with a
+  // single synchronization). The default implementation loops over Send().
+  //
+  // SendBatch() never blocks.
+  virtual Status SendBatch(gtl::ArraySlice<BatchedSend> sends);
+
   // Callback provided by a tensor consumer waiting on the rendezvous.
   // It will be invoked when the tensor is available, or when a non-OK
   // status arises in the production of that tensor.  It also gets
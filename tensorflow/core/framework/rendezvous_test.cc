@@ -355,6 +355,68 @@ TEST_F(LocalRendezvousTest, MultiSends) {
   }
 }
 
+TEST_F(LocalRendezvousTest, SendBatch) {
+  static const int N = 50;
+  Rendezvous::Args args;
+  std::vector<Rendezvous::ParsedKey> keys;
+  std::vector<Tensor> tensors;
+  keys.reserve(N);
+  tensors.reserve(N);
+  for (int i = 0; i < N; ++i) {
+    keys.push_back(MakeKey(strings::StrCat(i)));
+    tensors.push_back(V(strings::StrCat(i)));
+  }
+  std::vector<Rendezvous::BatchedSend> sends(N);
+  for (int i = 0; i < N; ++i) {
+    sends[i].key = &keys[i];
+    sends[i].args = args;
+    sends[i].val = &tensors[i];
+  }
+  TF_ASSERT_OK(rendez_->SendBatch(sends));
+  Tensor val;
+  bool val_dead;
+  for (int i = 0; i < N; ++i) {
+    TF_ASSERT_OK(rendez_->Recv(keys[i], args, &val, &val_dead));
+    EXPECT_EQ(strings::StrCat(i), V(val));
+  }
+}
+
+TEST_F(LocalRendezvousTest, SendBatchWakesWaiters) {
+  static const int N = 50;
+  Rendezvous::Args args;
+  std::vector<Rendezvous::ParsedKey> keys;
+  std::vector<Tensor> tensors;
+  keys.reserve(N);
+  tensors.reserve(N);
+  for (int i = 0; i < N; ++i) {
+    keys.push_back(MakeKey(strings::StrCat(i)));
+    tensors.push_back(V(strings::StrCat(i)));
+  }
+  std::atomic<int> remaining(N);
+  Notification all_received;
+  for (int i = 0; i < N; ++i) {
+    rendez_->RecvAsync(keys[i], args,
+                       [i, &remaining, &all_received](
+                           const Status& s, const Rendezvous::Args&,
+                           const Rendezvous::Args&, const Tensor& val,
+                           const bool) {
+                         TF_ASSERT_OK(s);
+                         EXPECT_EQ(strings::StrCat(i), V(val));
+                         if (remaining.fetch_sub(1) == 1) {
+                           all_received.Notify();
+                         }
+                       });
+  }
+  std::vector<Rendezvous::BatchedSend> sends(N);
+  for (int i = 0; i < N; ++i) {
+    sends[i].key = &keys[i];
+    sends[i].args = args;
+    sends[i].val = &tensors[i];
+  }
+  TF_ASSERT_OK(rendez_->SendBatch(sends));
+  all_received.WaitForNotification();
+}
+
 TEST_F(LocalRendezvousTest, RecvAbort) {
   rendez_->Ref();
   SchedClosure([this]() {
@@ -451,6 +513,38 @@ void BM_SendRecv(::testing::benchmark::State& state) {
 }
 BENCHMARK(BM_SendRecv);
 
+void BM_SendBatch(::testing::benchmark::State& state) {
+  const int batch_size = state.range(0);
+  Rendezvous* rendez = NewLocalRendezvous();
+  Rendezvous::Args args;
+  std::vector<Rendezvous::ParsedKey> keys;
+  std::vector<Tensor> tensors;
+  keys.reserve(batch_size);
+  tensors.reserve(batch_size);
+  for (int i = 0; i < batch_size; ++i) {
+    keys.push_back(MakeKey(strings::StrCat(i)));
+    tensors.push_back(V(strings::StrCat(i)));
+  }
+  std::vector<Rendezvous::BatchedSend> sends(batch_size);
+  for (int i = 0; i < batch_size; ++i) {
+    sends[i].key = &keys[i];
+    sends[i].args = args;
+    sends[i].val = &tensors[i];
+  }
+  Tensor val(DT_STRING, TensorShape({}));
+  bool is_dead = false;
+  for (auto s : state) {
+    TF_CHECK_OK(rendez->SendBatch(sends));
+    for (int i = 0; i < batch_size; ++i) {
+      TF_CHECK_OK(rendez->Recv(keys[i], args, &val, &is_dead));
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          batch_size);
+  rendez->Unref();
+}
+BENCHMARK(BM_SendBatch)->Arg(16)->Arg(64)->Arg(400);
+
 void BM_RecvSend(::testing::benchmark::State& state) {
   Rendezvous* rendez = NewLocalRendezvous();
   Tensor orig = V("val");
@@ -142,6 +142,7 @@ void ResourceMgr::Clear() {
   {
     mutex_lock l(mu_);
     tmp_containers = std::move(containers_);
+    deletion_generation_.fetch_add(1, std::memory_order_release);
   }
   for (const auto& p : tmp_containers) {
     delete p.second;
@@ -277,6 +278,7 @@ Status ResourceMgr::PopResourceAndName(const string& container,
   }
   std::swap(resource_and_name, iter->second);
   b->erase(iter);
+  deletion_generation_.fetch_add(1, std::memory_order_release);
   return Status::OK();
 }
 
@@ -326,6 +328,7 @@ Status ResourceMgr::Cleanup(const string& container) {
     }
     b = iter->second;
     containers_.erase(iter);
+    deletion_generation_.fetch_add(1, std::memory_order_release);
   }
   CHECK(b != nullptr);
   delete b;
@@ -16,6 +16,7 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_FRAMEWORK_RESOURCE_MGR_H_
 #define TENSORFLOW_CORE_FRAMEWORK_RESOURCE_MGR_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -154,6 +155,13 @@ class ResourceMgr {
   // Returns the default container name for *this.
   const std::string& default_container() const { return default_container_; }
 
+  // A monotonic counter bumped whenever a resource or container is removed
+  // from this manager. Callers may cache the result of a lookup and
+  // revalidate it with a single atomic load; see ResourceHandleCache below.
+  int64_t deletion_generation() const {
+    return deletion_generation_.load(std::memory_order_acquire);
+  }
+
   // Creates a resource "name" in the "container".  The caller transfers
   // the ownership of one ref on "resource" to *this, regardless of whether this
   // operation succeeds or fails.
@@ -274,6 +282,7 @@ class ResourceMgr {
   const std::string default_container_;
   mutable mutex mu_;
   absl::flat_hash_map<string, Container*> containers_ TF_GUARDED_BY(mu_);
+  std::atomic<int64_t> deletion_generation_{0};
 
   template <typename T, bool use_dynamic_cast = false>
   Status LookupInternal(const std::string& container, const std::string& name,
@@ -391,6 +400,59 @@ template <typename T>
 Status LookupResource(OpKernelContext* ctx, const ResourceHandle& p,
                       core::RefCountPtr<T>* value);
 
+// Caches the resolved target of a ResourceMgr lookup inside a kernel so
+// that steady-state lookups skip the manager's shared mutex and string
+// hashing. Revalidation is one atomic load of the manager's deletion
+// generation: the cache is conservatively invalidated whenever *any*
+// resource is removed from the manager, in which case the next lookup
+// re-resolves through the normal path. The cached reference keeps the
+// resource alive between invalidations, matching the lifetime behavior of
+// ref-counting ResourceHandles.
+//
+// Thread-safe; intended to be held as a member of an OpKernel (kernels may
+// run concurrently).
+template <typename T>
+class ResourceHandleCache {
+ public:
+  Status Lookup(OpKernelContext* ctx, const ResourceHandle& handle,
+                core::RefCountPtr<T>* value) {
+    // Ref-counting handles already resolve without touching the manager.
+    if (handle.IsRefCounting()) {
+      return LookupResource(ctx, handle, value);
+    }
+    ResourceMgr* mgr = ctx->resource_manager();
+    const int64_t generation = mgr->deletion_generation();
+    {
+      tf_shared_lock l(mu_);
+      if (resource_ != nullptr && mgr_ == mgr && generation_ == generation &&
+          handle.container() == container_ && handle.name() == name_) {
+        T* resource = resource_.get();
+        resource->Ref();
+        value->reset(resource);
+        return Status::OK();
+      }
+    }
+    TF_RETURN_IF_ERROR(LookupResource(ctx, handle, value));
+    mutex_lock l(mu_);
+    mgr_ = mgr;
+    generation_ = generation;
+    container_ = handle.container();
+    name_ = handle.name();
+    T* resource = value->get();
+    resource->Ref();
+    resource_.reset(resource);
+    return Status::OK();
+  }
+
+ private:
+  mutex mu_;
+  ResourceMgr* mgr_ TF_GUARDED_BY(mu_) = nullptr;
+  int64_t generation_ TF_GUARDED_BY(mu_) = -1;
+  std::string container_ TF_GUARDED_BY(mu_);
+  std::string name_ TF_GUARDED_BY(mu_);
+  core::RefCountPtr<T> resource_ TF_GUARDED_BY(mu_);
+};
+
 // Looks up multiple resources pointed by a sequence of resource handles.  If
 // p[i] is uninitialized then values[i] is unmodified.
 template <typename T>
@@ -142,6 +142,29 @@ TEST(ResourceMgrTest, Basic) {
   TF_CHECK_OK(rm.Cleanup("bar"));
 }
 
+TEST(ResourceMgrTest, DeletionGeneration) {
+  ResourceMgr rm;
+  const int64_t gen0 = rm.deletion_generation();
+
+  // Creates and lookups do not invalidate cached lookups.
+  TF_CHECK_OK(rm.Create("foo", "bar", new Resource("cat")));
+  EXPECT_EQ("R/cat", Find<Resource>(rm, "foo", "bar"));
+  EXPECT_EQ(gen0, rm.deletion_generation());
+
+  // Every form of removal bumps the generation.
+  TF_CHECK_OK(rm.Delete<Resource>("foo", "bar"));
+  const int64_t gen1 = rm.deletion_generation();
+  EXPECT_LT(gen0, gen1);
+
+  TF_CHECK_OK(rm.Create("foo", "bar", new Resource("cat")));
+  TF_CHECK_OK(rm.Cleanup("foo"));
+  const int64_t gen2 = rm.deletion_generation();
+  EXPECT_LT(gen1, gen2);
+
+  rm.Clear();
+  EXPECT_LT(gen2, rm.deletion_generation());
+}
+
 TEST(ResourceMgrTest, CreateUnowned) {
   core::RefCountPtr<Resource> cat{new Resource("cat")};
   core::RefCountPtr<Resource> kitty{new Resource("kitty")};
@@ -502,6 +502,60 @@ Buffer<T>::~Buffer() {
   }
 }
 
+static Allocator* get_default_cpu_allocator();
+
+// Payload size up to which host tensors of trivial types embed their data in
+// the same heap object as the TensorBuffer, covering scalars and small shape
+// tensors.
+constexpr size_t kInlineTensorBytes = 16;
+
+// Backing store for small host tensors of trivially-copyable types: the
+// payload lives inside the buffer object itself, so creating such a tensor
+// costs a single operator-new instead of a TensorBuffer allocation plus a
+// separate aligned allocator call. The buffer still participates in the
+// normal refcounted sharing protocol, so aliasing, slicing and forwarding
+// behave exactly as for allocator-backed tensors.
+class InlineBuffer : public TensorBuffer {
+ public:
+  explicit InlineBuffer(size_t size) : TensorBuffer(storage_), size_(size) {
+    DCHECK_LE(size, kInlineTensorBytes);
+  }
+
+  size_t size() const override { return size_; }
+  TensorBuffer* root_buffer() override { return this; }
+  void FillAllocationDescription(AllocationDescription* proto) const override {
+    proto->set_requested_bytes(size_);
+    proto->set_allocated_bytes(sizeof(InlineBuffer));
+    proto->set_allocator_name("inline");
+  }
+  bool GetAllocatedBytes(size_t* out_bytes) const override {
+    *out_bytes = sizeof(InlineBuffer);
+    return true;
+  }
+
+ private:
+  ~InlineBuffer() override = default;
+
+  const size_t size_;
+  alignas(EIGEN_MAX_ALIGN_BYTES) char storage_[kInlineTensorBytes];
+
+  TF_DISALLOW_COPY_AND_ASSIGN(InlineBuffer);
+};
+
+// Creates the backing buffer for a tensor of `n` elements of type T
+// allocated from `a`. Small tensors of trivial types created with the
+// default CPU allocator take the inline single-allocation path; everything
+// else gets a regular allocator-backed Buffer<T>.
+template <typename T>
+TensorBuffer* MakeBuffer(Allocator* a, int64_t n) {
+  if (std::is_trivial<T>::value && sizeof(T) <= kInlineTensorBytes &&
+      static_cast<uint64>(n) <= kInlineTensorBytes / sizeof(T) &&
+      a == get_default_cpu_allocator()) {
+    return new InlineBuffer(n * sizeof(T));
+  }
+  return new Buffer<T>(a, n);
+}
+
 // Allocates a T[n] buffer. Fills in the buffer with repeated values
 // in "in".  If "in" has less values than "n", fills the rest of T[n]
 // with the last value. If "in" has no values, fills T[n] with the
@@ -819,7 +873,7 @@ Tensor::Tensor(Allocator* a, DataType type, const TensorShape& shape)
   set_dtype(type);
   CHECK_NOTNULL(a);
   if (shape_.num_elements() > 0 || a->AllocatesOpaqueHandle()) {
-    CASES(type, buf_ = new Buffer<T>(a, shape.num_elements()));
+    CASES(type, buf_ = MakeBuffer<T>(a, shape.num_elements()));
   }
   if (MemoryLoggingEnabled() && buf_ != nullptr && buf_->data() != nullptr) {
     LogMemory::RecordTensorAllocation("Unknown", LogMemory::UNKNOWN_STEP_ID,
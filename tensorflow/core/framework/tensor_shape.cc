@@ -592,6 +592,35 @@ void TensorShapeBase<Shape>::set_dim(int d, int64_t size) {
   TF_CHECK_OK(RecomputeNumElements());
 }
 
+template <class Shape>
+Shape TensorShapeBase<Shape>::with_dim0(int64_t size) const {
+  DCHECK_GE(dims(), 1);
+  Shape out = *static_cast<const Shape*>(this);
+  const int64_t old_dim0 = dim_size(0);
+  // Incremental update: when the new extent fits the current representation
+  // and neither the old extent nor the element count is unknown, patch dim 0
+  // in place and rescale the cached element count.
+  if (old_dim0 > 0 && size >= 0 && num_elements() >= 0) {
+    if (out.tag() == REP16 && size < kMaxRep16) {
+      out.as16()->dims_[0] = static_cast<uint16>(size);
+      out.set_num_elements((num_elements() / old_dim0) * size);
+      return out;
+    }
+    if (out.tag() == REP32 && size < kMaxRep32) {
+      out.as32()->dims_[0] = static_cast<uint32>(size);
+      out.set_num_elements((num_elements() / old_dim0) * size);
+      return out;
+    }
+    if (out.tag() == REP_OUT_OF_LINE) {
+      (*out.as64()->dims_)[0] = size;
+      out.set_num_elements((num_elements() / old_dim0) * size);
+      return out;
+    }
+  }
+  out.set_dim(0, size);
+  return out;
+}
+
 template <class Shape>
 Status TensorShapeBase<Shape>::SetDimWithStatus(int d, int64_t size) {
   if (TF_PREDICT_FALSE(d < 0)) {
@@ -229,6 +229,15 @@ class TensorShapeBase : public TensorShapeRep {
   /// REQUIRES: `size >= 0`
   void set_dim(int d, int64_t size);
 
+  /// \brief Returns a copy of this shape with dimension 0 replaced by
+  /// `size`. Equivalent to copying the shape and calling `set_dim(0, size)`,
+  /// but updates the cached element count incrementally instead of
+  /// re-scanning every dimension - the common dynamic-batch serving case
+  /// where only dim 0 varies between steps. Callers with a fixed per-kernel
+  /// shape template can hold it and stamp out per-step shapes with this.
+  /// REQUIRES: `dims() >= 1`
+  Shape with_dim0(int64_t size) const;
+
   /// Same as `set_dim` but returns a `Status`.
   /// Use if unsure if requirements in `set_dim` are satistified, to prevent
   /// `CHECK`-fail crashes.
@@ -55,6 +55,45 @@ TEST(TensorShapeTest, set_dim) {
   EXPECT_EQ(40, s.num_elements());
 }
 
+TEST(TensorShapeTest, WithDim0) {
+  // Small extents (rep16).
+  TensorShape s({10, 5});
+  TensorShape t = s.with_dim0(20);
+  EXPECT_EQ(TensorShape({20, 5}), t);
+  EXPECT_EQ(100, t.num_elements());
+  // The source shape is unchanged.
+  EXPECT_EQ(TensorShape({10, 5}), s);
+
+  // Extent that forces an upgrade out of rep16.
+  t = s.with_dim0(1 << 20);
+  EXPECT_EQ(TensorShape({1 << 20, 5}), t);
+  EXPECT_EQ((1 << 20) * 5, t.num_elements());
+
+  // Large extents (rep32 stays rep32).
+  TensorShape big({1 << 20, 3});
+  t = big.with_dim0(1 << 21);
+  EXPECT_EQ(TensorShape({1 << 21, 3}), t);
+  EXPECT_EQ((1LL << 21) * 3, t.num_elements());
+
+  // Zero batch.
+  t = s.with_dim0(0);
+  EXPECT_EQ(TensorShape({0, 5}), t);
+  EXPECT_EQ(0, t.num_elements());
+
+  // A zero-sized dim 0 cannot be rescaled incrementally; make sure the
+  // fallback path recomputes correctly.
+  TensorShape zero({0, 5});
+  t = zero.with_dim0(4);
+  EXPECT_EQ(TensorShape({4, 5}), t);
+  EXPECT_EQ(20, t.num_elements());
+
+  // Partial shapes with unknown inner dims keep them unknown.
+  PartialTensorShape p({-1, 7});
+  PartialTensorShape q = p.with_dim0(3);
+  EXPECT_EQ(3, q.dim_size(0));
+  EXPECT_EQ(7, q.dim_size(1));
+}
+
 TEST(TensorShapeTest, RemoveDim) {
   TensorShape s({10, 5});
   s.RemoveDim(0);
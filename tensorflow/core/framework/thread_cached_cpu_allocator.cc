@@ -0,0 +1,268 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/framework/thread_cached_cpu_allocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/framework/allocator_registry.h"
+#include "tensorflow/core/platform/logging.h"
+#include "tensorflow/core/platform/mem.h"
+#include "tensorflow/core/platform/mutex.h"
+#include "tensorflow/core/platform/types.h"
+
+namespace tensorflow {
+namespace {
+
+// An opt-in CPU allocator that fronts the system heap with per-thread
+// size-class caches, so that threads doing many small transient allocations
+// (e.g. parse-heavy input pipelines) stop contending on the global heap.
+// Enabled by setting TF_CPU_ALLOCATOR_USE_THREAD_CACHE=1, which registers it
+// above DefaultCPUAllocator; otherwise it is not registered at all.
+//
+// Blocks of up to kMaxCachedBytes are rounded up to a power-of-two size
+// class and carry a small (alignment-preserving) header recording their
+// class. Frees push the block onto the freeing thread's cache for that
+// class; allocations pop from the caller's cache and only fall through to
+// port::AlignedMalloc on a miss or for large blocks. There is deliberately
+// no central depot: blocks migrate between threads only through the heap,
+// which keeps both paths lock-free.
+class ThreadCachedCPUAllocator : public Allocator {
+ public:
+  ThreadCachedCPUAllocator() = default;
+  ~ThreadCachedCPUAllocator() override = default;
+
+  string Name() override { return "cpu_thread_cached"; }
+
+  void* AllocateRaw(size_t alignment, size_t num_bytes) override {
+    void* ptr;
+    if (alignment <= kHeaderBytes && num_bytes <= kMaxCachedBytes) {
+      const int size_class = SizeClass(num_bytes);
+      ThreadCache& cache = thread_cache();
+      void* base = cache.Pop(size_class);
+      if (base == nullptr) {
+        base = port::AlignedMalloc(ClassBytes(size_class) + kHeaderBytes,
+                                   kHeaderBytes);
+        if (base == nullptr) return nullptr;
+      }
+      ptr = static_cast<char*>(base) + kHeaderBytes;
+      // The header sits immediately below the returned pointer, where
+      // DeallocateRaw and AllocatedSizeSlow read it back.
+      Header* h = static_cast<Header*>(ptr) - 1;
+      h->size_class = size_class;
+      h->payload_bytes = ClassBytes(size_class);
+    } else {
+      // Large or over-aligned blocks bypass the cache but still carry a
+      // header so DeallocateRaw can tell the two populations apart.
+      const size_t header = std::max(alignment, kHeaderBytes);
+      void* base = port::AlignedMalloc(num_bytes + header, header);
+      if (base == nullptr) return nullptr;
+      Header* h = reinterpret_cast<Header*>(static_cast<char*>(base) + header) -
+                  1;
+      h->size_class = kUncachedClass;
+      h->large_base_offset = header;
+      h->payload_bytes = num_bytes;
+      ptr = static_cast<char*>(base) + header;
+    }
+    if (cpu_allocator_collect_stats_enabled()) {
+      RecordAlloc(static_cast<Header*>(ptr)[-1].payload_bytes);
+    }
+    return ptr;
+  }
+
+  void DeallocateRaw(void* ptr) override {
+    if (ptr == nullptr) return;
+    Header* h = static_cast<Header*>(ptr) - 1;
+    if (cpu_allocator_collect_stats_enabled()) {
+      RecordDealloc(h->payload_bytes);
+    }
+    if (h->size_class == kUncachedClass) {
+      port::AlignedFree(static_cast<char*>(ptr) - h->large_base_offset);
+      return;
+    }
+    const int size_class = h->size_class;
+    void* base = static_cast<char*>(ptr) - kHeaderBytes;
+    if (!thread_cache().Push(size_class, base)) {
+      port::AlignedFree(base);
+    }
+  }
+
+  size_t AllocatedSizeSlow(const void* ptr) const override {
+    return static_cast<const Header*>(ptr)[-1].payload_bytes;
+  }
+
+  absl::optional<AllocatorStats> GetStats() override {
+    if (!cpu_allocator_collect_stats_enabled()) return absl::nullopt;
+    mutex_lock l(mu_);
+    return stats_;
+  }
+
+  bool ClearStats() override {
+    if (!cpu_allocator_collect_stats_enabled()) return false;
+    mutex_lock l(mu_);
+    stats_.num_allocs = 0;
+    stats_.peak_bytes_in_use = stats_.bytes_in_use;
+    stats_.largest_alloc_size = 0;
+    return true;
+  }
+
+ private:
+  // The header is one alignment quantum so that the payload keeps the
+  // allocator's default (Eigen) alignment.
+  static constexpr size_t kHeaderBytes = Allocator::kAllocatorAlignment;
+  static constexpr size_t kMinClassBytes = 64;
+  static constexpr int kNumClasses = 10;  // 64B .. 32KB, powers of two.
+  static constexpr size_t kMaxCachedBytes = kMinClassBytes
+                                            << (kNumClasses - 1);
+  static constexpr int kUncachedClass = -1;
+  // Per-class, per-thread cache depth. With 10 classes this bounds a thread's
+  // cache at ~2MB of retained blocks.
+  static constexpr int kMaxCachedPerClass = 32;
+
+  struct Header {
+    int size_class;
+    // Bytes accounted against this block in AllocatorStats: the rounded
+    // class size for cached blocks, the requested size for uncached ones.
+    size_t payload_bytes;
+    // For uncached blocks: distance from the returned pointer back to the
+    // base address handed out by AlignedMalloc.
+    size_t large_base_offset;
+  };
+  static_assert(sizeof(Header) <= kHeaderBytes,
+                "Header must fit in one alignment quantum");
+
+  static size_t ClassBytes(int size_class) {
+    return kMinClassBytes << size_class;
+  }
+
+  static int SizeClass(size_t num_bytes) {
+    int size_class = 0;
+    while (ClassBytes(size_class) < num_bytes) ++size_class;
+    return size_class;
+  }
+
+  struct ThreadCache {
+    void* items[kNumClasses][kMaxCachedPerClass];
+    int count[kNumClasses] = {};
+
+    void* Pop(int size_class) {
+      int& n = count[size_class];
+      if (n == 0) return nullptr;
+      return items[size_class][--n];
+    }
+
+    bool Push(int size_class, void* base) {
+      int& n = count[size_class];
+      if (n == kMaxCachedPerClass) return false;
+      items[size_class][n++] = base;
+      return true;
+    }
+
+    ~ThreadCache() {
+      for (int c = 0; c < kNumClasses; ++c) {
+        for (int i = 0; i < count[c]; ++i) {
+          port::AlignedFree(items[c][i]);
+        }
+      }
+    }
+  };
+
+  static ThreadCache& thread_cache() {
+    static thread_local ThreadCache cache;
+    return cache;
+  }
+
+  static bool cpu_allocator_collect_stats_enabled() {
+    return CPUAllocatorStatsEnabled();
+  }
+
+  void RecordAlloc(size_t num_bytes) {
+    mutex_lock l(mu_);
+    ++stats_.num_allocs;
+    stats_.bytes_in_use += num_bytes;
+    stats_.peak_bytes_in_use =
+        std::max<int64_t>(stats_.peak_bytes_in_use, stats_.bytes_in_use);
+    stats_.largest_alloc_size =
+        std::max<int64_t>(stats_.largest_alloc_size, num_bytes);
+  }
+
+  void RecordDealloc(size_t num_bytes) {
+    mutex_lock l(mu_);
+    stats_.bytes_in_use -= num_bytes;
+  }
+
+  mutex mu_;
+  AllocatorStats stats_ TF_GUARDED_BY(mu_);
+
+  TF_DISALLOW_COPY_AND_ASSIGN(ThreadCachedCPUAllocator);
+};
+
+class ThreadCachedCPUAllocatorFactory : public AllocatorFactory {
+ public:
+  Allocator* CreateAllocator() override {
+    return new ThreadCachedCPUAllocator;
+  }
+
+  SubAllocator* CreateSubAllocator(int numa_node) override {
+    return new ThreadCachedCPUSubAllocator(new ThreadCachedCPUAllocator);
+  }
+
+ private:
+  class ThreadCachedCPUSubAllocator : public SubAllocator {
+   public:
+    explicit ThreadCachedCPUSubAllocator(ThreadCachedCPUAllocator* allocator)
+        : SubAllocator({}, {}), allocator_(allocator) {}
+
+    void* Alloc(size_t alignment, size_t num_bytes,
+                size_t* bytes_received) override {
+      *bytes_received = num_bytes;
+      return allocator_->AllocateRaw(alignment, num_bytes);
+    }
+
+    void Free(void* ptr, size_t num_bytes) override {
+      allocator_->DeallocateRaw(ptr);
+    }
+
+    bool SupportsCoalescing() const override { return false; }
+
+   private:
+    ThreadCachedCPUAllocator* allocator_;
+  };
+};
+
+// Registered only when explicitly requested, above DefaultCPUAllocator's
+// priority of 100.
+bool RegisterThreadCachedCPUAllocator() {
+  const char* value = getenv("TF_CPU_ALLOCATOR_USE_THREAD_CACHE");
+  if (value == nullptr || strcmp(value, "1") != 0) return false;
+  static AllocatorFactoryRegistration registration(
+      __FILE__, __LINE__, "ThreadCachedCPUAllocator", 200,
+      new ThreadCachedCPUAllocatorFactory);
+  return true;
+}
+
+const bool thread_cached_cpu_allocator_registered =
+    RegisterThreadCachedCPUAllocator();
+
+}  // namespace
+
+Allocator* NewThreadCachedCPUAllocatorForTesting() {
+  return new ThreadCachedCPUAllocator;
+}
+
+}  // namespace tensorflow
@@ -0,0 +1,32 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_CORE_FRAMEWORK_THREAD_CACHED_CPU_ALLOCATOR_H_
+#define TENSORFLOW_CORE_FRAMEWORK_THREAD_CACHED_CPU_ALLOCATOR_H_
+
+#include "tensorflow/core/framework/allocator.h"
+
+namespace tensorflow {
+
+// Returns a new instance of the thread-cached CPU allocator, independent of
+// the TF_CPU_ALLOCATOR_USE_THREAD_CACHE registration (which happens at static
+// initialization time and therefore cannot be toggled by a test). The caller
+// owns the returned allocator. Production use goes through the allocator
+// registry.
+Allocator* NewThreadCachedCPUAllocatorForTesting();
+
+}  // namespace tensorflow
+
+#endif  // TENSORFLOW_CORE_FRAMEWORK_THREAD_CACHED_CPU_ALLOCATOR_H_
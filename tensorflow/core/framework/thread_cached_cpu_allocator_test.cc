@@ -0,0 +1,104 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/framework/thread_cached_cpu_allocator.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/core/framework/allocator.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+TEST(ThreadCachedCPUAllocatorTest, SmallBlockRoundTrip) {
+  EnableCPUAllocatorStats();
+  std::unique_ptr<Allocator> a(NewThreadCachedCPUAllocatorForTesting());
+  // Two rounds: the first allocates from the heap, the second pops the same
+  // blocks back off the thread cache. Every block must be aligned, writable
+  // end to end, and report at least the requested size.
+  for (int round = 0; round < 2; ++round) {
+    std::vector<void*> ptrs;
+    std::vector<size_t> sizes;
+    for (size_t bytes = 1; bytes <= 32 * 1024; bytes *= 2) {
+      void* p = a->AllocateRaw(Allocator::kAllocatorAlignment, bytes);
+      ASSERT_NE(p, nullptr);
+      EXPECT_EQ(
+          reinterpret_cast<uintptr_t>(p) % Allocator::kAllocatorAlignment, 0u);
+      memset(p, 0xab, bytes);
+      EXPECT_GE(a->AllocatedSizeSlow(p), bytes);
+      ptrs.push_back(p);
+      sizes.push_back(bytes);
+    }
+    for (void* p : ptrs) {
+      a->DeallocateRaw(p);
+    }
+  }
+  DisableCPUAllocatorStats();
+}
+
+TEST(ThreadCachedCPUAllocatorTest, ReusesCachedBlocks) {
+  std::unique_ptr<Allocator> a(NewThreadCachedCPUAllocatorForTesting());
+  // A freed small block lands on the freeing thread's cache and the next
+  // allocation of the same size class must pop it back.
+  void* p1 = a->AllocateRaw(Allocator::kAllocatorAlignment, 100);
+  ASSERT_NE(p1, nullptr);
+  memset(p1, 1, 100);
+  a->DeallocateRaw(p1);
+  void* p2 = a->AllocateRaw(Allocator::kAllocatorAlignment, 128);
+  EXPECT_EQ(p1, p2);
+  a->DeallocateRaw(p2);
+}
+
+TEST(ThreadCachedCPUAllocatorTest, LargeAndOveralignedBlocksBypassTheCache) {
+  std::unique_ptr<Allocator> a(NewThreadCachedCPUAllocatorForTesting());
+  constexpr size_t kLargeBytes = 1 << 20;
+  void* large = a->AllocateRaw(Allocator::kAllocatorAlignment, kLargeBytes);
+  ASSERT_NE(large, nullptr);
+  memset(large, 0xcd, kLargeBytes);
+  EXPECT_EQ(a->AllocatedSizeSlow(large), kLargeBytes);
+  a->DeallocateRaw(large);
+
+  const size_t big_alignment = 2 * Allocator::kAllocatorAlignment;
+  void* aligned = a->AllocateRaw(big_alignment, 256);
+  ASSERT_NE(aligned, nullptr);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % big_alignment, 0u);
+  memset(aligned, 0xef, 256);
+  a->DeallocateRaw(aligned);
+}
+
+TEST(ThreadCachedCPUAllocatorTest, Statistics) {
+  EnableCPUAllocatorStats();
+  std::unique_ptr<Allocator> a(NewThreadCachedCPUAllocatorForTesting());
+  // Cached blocks are accounted at their rounded size-class bytes; 256 is
+  // exactly a class size, so the numbers match the request.
+  void* p = a->AllocateRaw(Allocator::kAllocatorAlignment, 256);
+  ASSERT_NE(p, nullptr);
+  auto stats = a->GetStats();
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(stats->num_allocs, 1);
+  EXPECT_EQ(stats->bytes_in_use, 256);
+  EXPECT_EQ(stats->peak_bytes_in_use, 256);
+  a->DeallocateRaw(p);
+  stats = a->GetStats();
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(stats->bytes_in_use, 0);
+  DisableCPUAllocatorStats();
+}
+
+}  // namespace
+}  // namespace tensorflow
@@ -36,8 +36,11 @@ limitations under the License.
 #include "tensorflow/core/graph/node_builder.h"
 #include "tensorflow/core/graph/tensor_id.h"
 #include "tensorflow/core/lib/core/errors.h"
+#include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/lib/hash/hash.h"
 #include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/util/device_name_utils.h"
 #include "tensorflow/core/util/dump_graph.h"
@@ -573,29 +576,67 @@ Status AddControlLoop(const PartitionOptions& opts, Graph* g, const Node* src,
 // TODO(yuanbyu): It might be simpler if we convert MemoryType to
 // DeviceType for the inputs/outputs of each node.
 Status BuildMemoryDeviceInfo(const Graph& g, GraphInfo* info) {
-  MemoryTypeVector input_memory_types;
-  MemoryTypeVector output_memory_types;
-
   info->device_types.resize(g.num_node_ids(), DEVICE_CPU);
+
+  std::vector<const Node*> op_nodes;
+  op_nodes.reserve(g.num_op_nodes());
   for (const Node* node : g.op_nodes()) {
-    DeviceNameUtils::ParsedName parsed;
-    if (!DeviceNameUtils::ParseFullName(node->assigned_device_name(),
-                                        &parsed)) {
-      return errors::Internal("Malformed assigned device '",
-                              node->assigned_device_name(), "'");
+    op_nodes.push_back(node);
+  }
+
+  // The memory-type query (device name parsing plus a kernel-registry
+  // lookup) is independent per node and dominates the cost of this pass on
+  // large graphs, so it is computed in parallel; the results are merged into
+  // the shared maps single-threaded below.
+  struct NodeMemoryInfo {
+    MemoryTypeVector input_memory_types;
+    MemoryTypeVector output_memory_types;
+    DeviceType device_type = DeviceType(DEVICE_CPU);
+    Status status;
+  };
+  std::vector<NodeMemoryInfo> node_info(op_nodes.size());
+  const auto compute_range = [&g, &op_nodes, &node_info](int64_t begin,
+                                                         int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      const Node* node = op_nodes[i];
+      NodeMemoryInfo& result = node_info[i];
+      DeviceNameUtils::ParsedName parsed;
+      if (!DeviceNameUtils::ParseFullName(node->assigned_device_name(),
+                                          &parsed)) {
+        result.status = errors::Internal("Malformed assigned device '",
+                                         node->assigned_device_name(), "'");
+        continue;
+      }
+      result.device_type = DeviceType(parsed.type);
+      result.status = MemoryTypesForNode(
+          g.op_registry(), result.device_type, node->def(),
+          &result.input_memory_types, &result.output_memory_types);
     }
+  };
 
-    TF_RETURN_IF_ERROR(MemoryTypesForNode(
-        g.op_registry(), DeviceType(parsed.type), node->def(),
-        &input_memory_types, &output_memory_types));
+  // Spinning up a pool only pays off for graphs that take visible time to
+  // analyze; small graphs stay on the calling thread.
+  constexpr size_t kMinNodesForParallelBuild = 4096;
+  if (op_nodes.size() >= kMinNodesForParallelBuild) {
+    thread::ThreadPool pool(Env::Default(), "build_memory_device_info",
+                            port::NumSchedulableCPUs());
+    pool.ParallelFor(op_nodes.size(), /*cost_per_unit=*/5000, compute_range);
+  } else {
+    compute_range(0, op_nodes.size());
+  }
 
-    int node_id = node->id();
-    info->device_types[node_id] = DeviceType(parsed.type);
-    for (int i = 0; i < input_memory_types.size(); ++i) {
-      info->input_types[{node_id, i}] = input_memory_types[i];
+  for (size_t i = 0; i < op_nodes.size(); ++i) {
+    TF_RETURN_IF_ERROR(node_info[i].status);
+    const int node_id = op_nodes[i]->id();
+    info->device_types[node_id] = node_info[i].device_type;
+    const MemoryTypeVector& input_memory_types = node_info[i].input_memory_types;
+    for (int j = 0; j < input_memory_types.size(); ++j) {
+      info->input_types[{node_id, j}] = input_memory_types[j];
     }
-    for (int i = 0; i < output_memory_types.size(); ++i) {
-      info->output_types[{node_id, i}] = output_memory_types[i];
+    const MemoryTypeVector& output_memory_types =
+        node_info[i].output_memory_types;
+    for (int j = 0; j < output_memory_types.size(); ++j) {
+      info->output_types[{node_id, j}] = output_memory_types[j];
     }
   }
   return Status::OK();
@@ -999,6 +1040,14 @@ Status Partition(const PartitionOptions& opts, Graph* g,
   status = BuildMemoryDeviceInfo(*g, &g_info);
   if (!status.ok()) return status;
 
+  // The node_to_loc callback typically materializes a device-name string;
+  // memoize it per node up front, since the loop below would otherwise
+  // re-invoke it for the source of every edge.
+  std::vector<string> node_loc(g->num_node_ids());
+  for (const Node* node : g->op_nodes()) {
+    node_loc[node->id()] = opts.node_to_loc(node);
+  }
+
   string dstp;
   std::vector<const Edge*> inputs;
   DupRecvTable dup_recv(3);
@@ -1012,7 +1061,7 @@ Status Partition(const PartitionOptions& opts, Graph* g,
   int32_t num_data = 0;
   int32_t num_control = 0;
   for (const Node* dst : g->op_nodes()) {
-    dstp = opts.node_to_loc(dst);
+    dstp = node_loc[dst->id()];
     GraphDef* dst_graph = &(*partitions)[dstp];
     NodeDef* dst_def = dst_graph->add_node();
     *dst_def = dst->def();
@@ -1070,7 +1119,7 @@ Status Partition(const PartitionOptions& opts, Graph* g,
       const Node* src = edge->src();
       if (!src->IsOp()) continue;  // Skip Sink/Source nodes.
 
-      GraphDef* src_graph = &(*partitions)[opts.node_to_loc(src)];
+      GraphDef* src_graph = &(*partitions)[node_loc[src->id()]];
       if (src_graph == dst_graph && !NeedSameDeviceSendRecv(edge, g_info)) {
         // Same partition and compatible memory types:
         AddInput(dst_def, src->name(), edge->src_output());
@@ -16,7 +16,13 @@ limitations under the License.
 
 #include "tensorflow/core/grappler/costs/op_level_cost_estimator.h"
 
+#include <cstdlib>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
 #include "third_party/eigen3/Eigen/Core"
 #include "tensorflow/core/framework/attr_value.pb.h"
 #include "tensorflow/core/framework/attr_value_util.h"
@@ -26,6 +32,8 @@ limitations under the License.
 #include "tensorflow/core/grappler/clusters/utils.h"
 #include "tensorflow/core/grappler/costs/op_context.h"
 #include "tensorflow/core/grappler/costs/utils.h"
+#include "tensorflow/core/lib/strings/strcat.h"
+#include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/errors.h"
 #include "tensorflow/core/util/overflow.h"
 
@@ -648,7 +656,95 @@ OpLevelCostEstimator::OpLevelCostEstimator() {
   compute_memory_overlap_ = false;
 }
 
+namespace {
+
+// Optional database of measured per-op-signature execution times, loaded
+// from the file named by TF_OP_COST_DATABASE. Analytic roofline formulas
+// are systematically wrong for custom ops and small shapes; measured times,
+// when available for a signature, override them so placement and scheduling
+// see reality. File format: one entry per line,
+//   <op>(<shape>;<shape>;...) <execution_time_ns>
+// where each <shape> is dims joined by 'x' (e.g. Conv2D(32x224x224x3;...)).
+// Unknown signatures fall through to the analytic estimate.
+class MeasuredCostDatabase {
+ public:
+  static const MeasuredCostDatabase* Global() {
+    static const MeasuredCostDatabase* db = new MeasuredCostDatabase;
+    return db;
+  }
+
+  // Returns true and sets *execution_time_ns on a hit.
+  bool Lookup(const OpContext& op_context, int64_t* execution_time_ns) const {
+    if (costs_.empty()) return false;
+    auto it = costs_.find(Signature(op_context));
+    if (it == costs_.end()) return false;
+    *execution_time_ns = it->second;
+    return true;
+  }
+
+  static std::string Signature(const OpContext& op_context) {
+    std::string signature = op_context.op_info.op();
+    signature += '(';
+    bool first = true;
+    for (const auto& input : op_context.op_info.inputs()) {
+      if (!first) signature += ';';
+      first = false;
+      bool first_dim = true;
+      for (const auto& dim : input.shape().dim()) {
+        if (!first_dim) signature += 'x';
+        first_dim = false;
+        strings::StrAppend(&signature, dim.size());
+      }
+    }
+    signature += ')';
+    return signature;
+  }
+
+ private:
+  MeasuredCostDatabase() {
+    const char* path = std::getenv("TF_OP_COST_DATABASE");
+    if (path == nullptr) return;
+    string contents;
+    Status status = ReadFileToString(Env::Default(), path, &contents);
+    if (!status.ok()) {
+      LOG(WARNING) << "Could not read op cost database " << path << ": "
+                   << status;
+      return;
+    }
+    for (absl::string_view line : absl::StrSplit(contents, '\n')) {
+      line = absl::StripAsciiWhitespace(line);
+      if (line.empty() || line[0] == '#') continue;
+      std::vector<absl::string_view> parts =
+          absl::StrSplit(line, ' ', absl::SkipEmpty());
+      int64_t time_ns;
+      if (parts.size() != 2 || !absl::SimpleAtoi(parts[1], &time_ns)) {
+        LOG(WARNING) << "Skipping malformed op cost database line: " << line;
+        continue;
+      }
+      costs_[std::string(parts[0])] = time_ns;
+    }
+    LOG(INFO) << "Loaded " << costs_.size() << " measured op costs from "
+              << path;
+  }
+
+  absl::flat_hash_map<std::string, int64_t> costs_;
+};
+
+}  // namespace
+
 Costs OpLevelCostEstimator::PredictCosts(const OpContext& op_context) const {
+  // Measured costs, when recorded for this signature, beat any analytic
+  // model.
+  int64_t measured_time_ns;
+  if (MeasuredCostDatabase::Global()->Lookup(op_context, &measured_time_ns)) {
+    Costs measured = Costs::ZeroCosts();
+    measured.execution_time = Costs::Duration(measured_time_ns);
+    measured.compute_time = measured.execution_time;
+    measured.inaccurate = false;
+    measured.num_ops_with_unknown_shapes = 0;
+    return measured;
+  }
+
   Costs costs;
   NodeCosts node_costs;
   if (PredictNodeCosts(op_context, &node_costs).ok()) {
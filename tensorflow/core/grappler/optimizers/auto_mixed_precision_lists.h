@@ -20,6 +20,7 @@ limitations under the License.
 
 #include "tensorflow/core/lib/gtl/flatset.h"
 #include "tensorflow/core/lib/strings/str_util.h"
+#include "tensorflow/core/platform/cpu_info.h"
 #include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
@@ -375,6 +376,17 @@ class AutoMixedPrecisionListsMkl : public AutoMixedPrecisionLists {
                                      "BatchMatMul",
                                      "BatchMatMulV2"};
 
+    // CPUs with native bf16 compute (AMX or AVX512-BF16) make the fused
+    // contraction ops profitable in bf16 as well; keeping them fp32 would
+    // put a cast boundary in the middle of every fused matmul/conv region.
+    // Without native bf16 the emulated math is a wash, so they stay out.
+    if (port::TestCPUFeature(port::CPUFeature::AMX_BF16) ||
+        port::TestCPUFeature(port::CPUFeature::AVX512_BF16)) {
+      list.insert("_FusedMatMul");
+      list.insert("_FusedConv2D");
+      list.insert("Einsum");
+    }
+
     UpdateList("ALLOWLIST", &list);
     // For backwards compatibility, keeping the original env variable here.
     // TODO(reedwm): This should be removed if we don't have active users.
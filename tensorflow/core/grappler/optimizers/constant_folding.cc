@@ -17,6 +17,9 @@ limitations under the License.
 
 #include "tensorflow/core/grappler/optimizers/constant_folding.h"
 
+#include <cstdlib>
+#include <cstring>
+
 #include <cmath>
 
 #include "absl/strings/string_view.h"
@@ -4028,7 +4031,26 @@ Status ConstantFolding::Optimize(Cluster* cluster, const GrapplerItem& item,
   port::ScopedFlushDenormal flush;
   port::ScopedSetRound round(FE_TONEAREST);
   nodes_to_preserve_ = item.NodesToPreserve();
+
+  // With TF_CONSTANT_FOLD_SCALAR_FEEDS=1, scalar config-like feeds (bool /
+  // int / string scalars, e.g. is_training or a mode switch) are treated as
+  // fixed: the placeholder is replaced with a Const of the fed value below,
+  // which lets ordinary folding evaluate the predicates guarding
+  // training-only branches and prune them. Tensor-valued data feeds are
+  // never constantized. Opting in asserts that those scalars do not change
+  // across Run calls of the optimized graph.
+  static const bool fold_scalar_feeds = [] {
+    const char* env = std::getenv("TF_CONSTANT_FOLD_SCALAR_FEEDS");
+    return env != nullptr && strcmp(env, "1") == 0;
+  }();
+  auto is_config_like_feed = [](const std::pair<string, Tensor>& feed) {
+    if (feed.second.dims() != 0) return false;
+    const DataType dtype = feed.second.dtype();
+    return dtype == DT_BOOL || dtype == DT_INT32 || dtype == DT_INT64 ||
+           dtype == DT_STRING;
+  };
   for (const auto& feed : item.feed) {
+    if (fold_scalar_feeds && is_config_like_feed(feed)) continue;
     feed_nodes_.insert(NodeName(feed.first));
   }
 
@@ -4047,6 +4069,31 @@ Status ConstantFolding::Optimize(Cluster* cluster, const GrapplerItem& item,
 
   has_fetch_ = !item.fetch.empty();
   GrapplerItem item_to_optimize = item;
+  if (fold_scalar_feeds) {
+    for (const auto& feed : item.feed) {
+      if (!is_config_like_feed(feed)) continue;
+      const string node_name = NodeName(feed.first);
+      for (NodeDef& node : *item_to_optimize.graph.mutable_node()) {
+        if (node.name() != node_name) continue;
+        if (node.op() != "Placeholder" && node.op() != "PlaceholderV2" &&
+            node.op() != "PlaceholderWithDefault") {
+          break;
+        }
+        VLOG(1) << "Constantizing scalar feed " << node_name;
+        node.set_op("Const");
+        node.clear_input();
+        node.mutable_attr()->erase("shape");
+        node.mutable_attr()->erase("dtype");
+        AttrValue dtype_attr;
+        dtype_attr.set_type(feed.second.dtype());
+        node.mutable_attr()->insert({"dtype", dtype_attr});
+        AttrValue value_attr;
+        feed.second.AsProtoTensorContent(value_attr.mutable_tensor());
+        node.mutable_attr()->insert({"value", value_attr});
+        break;
+      }
+    }
+  }
   GraphProperties properties(item_to_optimize);
   // It's possible to feed a placeholder with a tensor of any shape: make sure
   // that the shape inference deals with this conservatively unless we're in
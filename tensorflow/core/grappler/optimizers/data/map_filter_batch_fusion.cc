@@ -0,0 +1,125 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/grappler/optimizers/data/map_filter_batch_fusion.h"
+
+#include "absl/container/flat_hash_set.h"
+#include "tensorflow/core/framework/attr_value.pb.h"
+#include "tensorflow/core/framework/node_def.pb.h"
+#include "tensorflow/core/grappler/clusters/cluster.h"
+#include "tensorflow/core/grappler/grappler_item.h"
+#include "tensorflow/core/grappler/mutable_graph_view.h"
+#include "tensorflow/core/grappler/op_types.h"
+#include "tensorflow/core/grappler/optimizers/custom_graph_optimizer_registry.h"
+#include "tensorflow/core/grappler/optimizers/data/graph_utils.h"
+#include "tensorflow/core/grappler/utils.h"
+#include "tensorflow/core/platform/protobuf.h"
+
+namespace tensorflow {
+namespace grappler {
+namespace {
+
+constexpr char kFusedOpName[] = "MapFilterBatchDataset";
+
+NodeDef MakeMapFilterBatchNode(const NodeDef& map_node,
+                               const NodeDef& filter_node,
+                               const NodeDef& batch_node,
+                               MutableGraphView* graph) {
+  NodeDef new_node;
+  new_node.set_op(kFusedOpName);
+  graph_utils::SetUniqueGraphNodeName(kFusedOpName, graph->graph(), &new_node);
+
+  // `input_dataset`.
+  new_node.add_input(map_node.input(0));
+
+  // The map function's `other_arguments`.
+  for (int i = 1; i < map_node.input_size(); i++) {
+    new_node.add_input(map_node.input(i));
+  }
+
+  // `batch_size`.
+  new_node.add_input(batch_node.input(1));
+
+  // `drop_remainder`.
+  if (batch_node.op() == "BatchDatasetV2") {
+    new_node.add_input(batch_node.input(2));
+  } else {
+    NodeDef* tmp = graph_utils::AddScalarConstNode<bool>(false, graph);
+    new_node.add_input(tmp->name());
+  }
+
+  // The predicate's `predicate_other_arguments`.
+  for (int i = 1; i < filter_node.input_size(); i++) {
+    new_node.add_input(filter_node.input(i));
+  }
+
+  // Required attributes.
+  graph_utils::CopyAttribute("f", map_node, &new_node);
+  graph_utils::CopyAttribute("Targuments", map_node, &new_node);
+  (*new_node.mutable_attr())["predicate"] = filter_node.attr().at("predicate");
+  (*new_node.mutable_attr())["Tpredicate_arguments"] =
+      filter_node.attr().at("Targuments");
+  graph_utils::CopyShapesAndTypesAttrs(batch_node, &new_node);
+
+  graph_utils::MaybeSetFusedMetadata(map_node, batch_node, &new_node);
+  return new_node;
+}
+
+}  // namespace
+
+Status MapFilterBatchFusion::OptimizeAndCollectStats(Cluster* cluster,
+                                                     const GrapplerItem& item,
+                                                     GraphDef* output,
+                                                     OptimizationStats* stats) {
+  *output = item.graph;
+  MutableGraphView graph(output);
+  absl::flat_hash_set<string> nodes_to_delete;
+  for (const NodeDef& node : item.graph.node()) {
+    if (node.op() != "BatchDataset" && node.op() != "BatchDatasetV2") {
+      continue;
+    }
+    const NodeDef& batch_node = node;
+
+    NodeDef* filter_node = graph_utils::GetInputNode(batch_node, graph);
+    if (filter_node->op() != "FilterDataset") {
+      continue;
+    }
+
+    NodeDef* map_node = graph_utils::GetInputNode(*filter_node, graph);
+    // Only the sequential map qualifies: a parallel map's asynchrony cannot
+    // be reproduced inside the (sequential) fused iterator.
+    if (map_node->op() != "MapDataset") {
+      continue;
+    }
+
+    auto* new_node = graph.AddNode(
+        MakeMapFilterBatchNode(*map_node, *filter_node, batch_node, &graph));
+    TF_RETURN_IF_ERROR(
+        graph.UpdateFanouts(batch_node.name(), new_node->name()));
+
+    nodes_to_delete.insert(map_node->name());
+    nodes_to_delete.insert(filter_node->name());
+    nodes_to_delete.insert(batch_node.name());
+    stats->num_changes++;
+  }
+
+  TF_RETURN_IF_ERROR(graph.DeleteNodes(nodes_to_delete));
+  return Status::OK();
+}
+
+REGISTER_GRAPH_OPTIMIZER_AS(MapFilterBatchFusion, "map_filter_batch_fusion");
+
+}  // namespace grappler
+}  // namespace tensorflow
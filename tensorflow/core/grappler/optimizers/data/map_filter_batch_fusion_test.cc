@@ -0,0 +1,141 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/grappler/optimizers/data/map_filter_batch_fusion.h"
+
+#include "tensorflow/core/framework/attr_value_util.h"
+#include "tensorflow/core/grappler/grappler_item.h"
+#include "tensorflow/core/grappler/optimizers/data/graph_test_utils.h"
+#include "tensorflow/core/grappler/optimizers/data/graph_utils.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace grappler {
+namespace {
+
+NodeDef* AddRangeNode(MutableGraphView* graph) {
+  NodeDef* start_node = graph_utils::AddScalarConstNode<int64_t>(0, graph);
+  NodeDef* stop_node = graph_utils::AddScalarConstNode<int64_t>(10, graph);
+  NodeDef* step_node = graph_utils::AddScalarConstNode<int64_t>(1, graph);
+  std::vector<string> range_inputs = {start_node->name(), stop_node->name(),
+                                      step_node->name()};
+  std::vector<std::pair<string, AttrValue>> range_attrs;
+  return graph_utils::AddNode("range", "RangeDataset", range_inputs,
+                              range_attrs, graph);
+}
+
+NodeDef* AddBatchV2Node(StringPiece input_name, MutableGraphView* graph) {
+  NodeDef* batch_size_node =
+      graph_utils::AddScalarConstNode<int64_t>(5, graph);
+  NodeDef* drop_remainder_node =
+      graph_utils::AddScalarConstNode<bool>(true, graph);
+  std::vector<string> batch_inputs = {string(input_name),
+                                      batch_size_node->name(),
+                                      drop_remainder_node->name()};
+  std::vector<std::pair<string, AttrValue>> batch_attrs(2);
+  AttrValue shapes_attr;
+  SetAttrValue("output_shapes", &shapes_attr);
+  batch_attrs[0] = std::make_pair("output_shapes", shapes_attr);
+  AttrValue types_attr;
+  SetAttrValue("output_types", &types_attr);
+  batch_attrs[1] = std::make_pair("output_types", types_attr);
+  return graph_utils::AddNode("batch", "BatchDatasetV2", batch_inputs,
+                              batch_attrs, graph);
+}
+
+TEST(MapFilterBatchFusionTest, FuseMapFilterBatchChain) {
+  GrapplerItem item;
+  MutableGraphView graph(&item.graph);
+
+  NodeDef* range_node = AddRangeNode(&graph);
+  NodeDef map_def = graph_tests_utils::MakeMapNode(
+      "map", range_node->name(), "XTimesTwo");
+  NodeDef* map_node = graph.AddNode(std::move(map_def));
+  NodeDef filter_def = graph_tests_utils::MakeFilterNode(
+      "filter", map_node->name(), "IsZero");
+  NodeDef* filter_node = graph.AddNode(std::move(filter_def));
+  NodeDef* batch_node = AddBatchV2Node(filter_node->name(), &graph);
+
+  MapFilterBatchFusion optimizer;
+  GraphDef output;
+  TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &output));
+
+  EXPECT_FALSE(graph_utils::ContainsGraphNodeWithName("map", output));
+  EXPECT_FALSE(graph_utils::ContainsGraphNodeWithName("filter", output));
+  EXPECT_FALSE(
+      graph_utils::ContainsGraphNodeWithName(batch_node->name(), output));
+  ASSERT_TRUE(
+      graph_utils::ContainsNodeWithOp("MapFilterBatchDataset", output));
+
+  const NodeDef& fused_node = output.node(
+      graph_utils::FindGraphNodeWithOp("MapFilterBatchDataset", output));
+  // input_dataset, batch_size, drop_remainder (neither function has
+  // captured arguments in this graph).
+  ASSERT_EQ(fused_node.input_size(), 3);
+  EXPECT_EQ(fused_node.input(0), range_node->name());
+  EXPECT_TRUE(fused_node.attr().contains("f"));
+  EXPECT_TRUE(fused_node.attr().contains("predicate"));
+  EXPECT_TRUE(fused_node.attr().contains("Targuments"));
+  EXPECT_TRUE(fused_node.attr().contains("Tpredicate_arguments"));
+  EXPECT_TRUE(fused_node.attr().contains("output_shapes"));
+  EXPECT_TRUE(fused_node.attr().contains("output_types"));
+}
+
+TEST(MapFilterBatchFusionTest, NoFusionWithoutFilter) {
+  GrapplerItem item;
+  MutableGraphView graph(&item.graph);
+
+  NodeDef* range_node = AddRangeNode(&graph);
+  NodeDef map_def = graph_tests_utils::MakeMapNode(
+      "map", range_node->name(), "XTimesTwo");
+  NodeDef* map_node = graph.AddNode(std::move(map_def));
+  AddBatchV2Node(map_node->name(), &graph);
+
+  MapFilterBatchFusion optimizer;
+  GraphDef output;
+  TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &output));
+
+  EXPECT_FALSE(
+      graph_utils::ContainsNodeWithOp("MapFilterBatchDataset", output));
+  EXPECT_TRUE(graph_utils::ContainsGraphNodeWithName("map", output));
+}
+
+TEST(MapFilterBatchFusionTest, NoFusionForParallelMap) {
+  GrapplerItem item;
+  MutableGraphView graph(&item.graph);
+
+  NodeDef* range_node = AddRangeNode(&graph);
+  NodeDef map_def = graph_tests_utils::MakeParallelMapNode(
+      "map", range_node->name(),
+      graph_utils::AddScalarConstNode<int64_t>(2, &graph)->name(), "XTimesTwo",
+      /*sloppy=*/false);
+  NodeDef* map_node = graph.AddNode(std::move(map_def));
+  NodeDef filter_def = graph_tests_utils::MakeFilterNode(
+      "filter", map_node->name(), "IsZero");
+  NodeDef* filter_node = graph.AddNode(std::move(filter_def));
+  AddBatchV2Node(filter_node->name(), &graph);
+
+  MapFilterBatchFusion optimizer;
+  GraphDef output;
+  TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &output));
+
+  EXPECT_FALSE(
+      graph_utils::ContainsNodeWithOp("MapFilterBatchDataset", output));
+}
+
+}  // namespace
+}  // namespace grappler
+}  // namespace tensorflow
@@ -15,6 +15,10 @@ limitations under the License.
 
 #include "tensorflow/core/grappler/optimizers/function_optimizer.h"
 
+#include <cstdlib>
+
+#include "tensorflow/core/lib/strings/numbers.h"
+
 #include <vector>
 
 #include "absl/algorithm/container.h"
@@ -1344,6 +1348,36 @@ Status InlineFunctionCalls(const GrapplerItem& item,
       can_inline_function_call = ValidateNoDeadOutputs(flib_def, *fbody);
     }
 
+    // Growth budget: indiscriminate inlining can blow the graph up several
+    // fold, slowing every later optimization pass and executor startup more
+    // than the saved call overhead is worth. With
+    // TF_FUNCTION_INLINE_GROWTH_FACTOR=<f> (e.g. 2.0), a call site is only
+    // inlined while the graph holds fewer than f times the original node
+    // count; large function bodies (relative to the remaining budget) are
+    // kept as calls. Unset or <= 0 preserves the existing
+    // always-inline-when-valid behavior.
+    static const double growth_factor = [] {
+      double value = 0;
+      const char* env = std::getenv("TF_FUNCTION_INLINE_GROWTH_FACTOR");
+      if (env != nullptr && !strings::safe_strtod(env, &value)) {
+        LOG(WARNING) << "Invalid TF_FUNCTION_INLINE_GROWTH_FACTOR: " << env;
+        value = 0;
+      }
+      return value;
+    }();
+    if (can_inline_function_call.ok() && growth_factor > 0) {
+      const int64_t budget_nodes =
+          static_cast<int64_t>(growth_factor * item.graph.node_size());
+      const int64_t nodes_after_inline =
+          graph->num_nodes() + fbody->graph->num_nodes();
+      if (nodes_after_inline > budget_nodes) {
+        can_inline_function_call = errors::ResourceExhausted(
+            "Inlining ", n->name(), " (", fbody->graph->num_nodes(),
+            " nodes) would exceed the graph growth budget of ", budget_nodes,
+            " nodes");
+      }
+    }
+
     if (can_inline_function_call.ok()) {
       VLOG(2) << "Inline function call node: " << n->name();
       AddStrictInputSemantics(n, graph.get());
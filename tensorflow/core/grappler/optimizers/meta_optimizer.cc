@@ -15,10 +15,18 @@ limitations under the License.
 
 #include "tensorflow/core/grappler/optimizers/meta_optimizer.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <utility>
+
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/substitute.h"
 #include "tensorflow/core/common_runtime/function.h"
+#include "tensorflow/core/lib/strings/proto_serialization.h"
+#include "tensorflow/core/lib/strings/stringprintf.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/common_runtime/graph_constructor.h"
 #include "tensorflow/core/framework/dataset.h"
 #include "tensorflow/core/framework/function.pb.h"
@@ -693,6 +701,12 @@ Status MetaOptimizer::OptimizeGraph(Cluster* cluster, GrapplerItem&& item,
     CompressConstants(optimized_graph);
   }
 
+  // Change tracking for skipping no-op reruns: bumped whenever an optimizer
+  // modifies the graph, with each optimizer's last outcome and the epoch at
+  // which it last ran.
+  int64_t graph_change_epoch = 0;
+  std::map<string, std::pair<bool, int64_t>> last_run_info;
+
   for (int iteration = 0; iteration < NumIterations(cfg_); ++iteration) {
     // Don't bother optimizing further if the graph is already tiny.
     if (optimized_graph->node_size() < min_graph_nodes) {
@@ -722,8 +736,27 @@ Status MetaOptimizer::OptimizeGraph(Cluster* cluster, GrapplerItem&& item,
       }
 #endif
 
+      // Skip an optimizer on later iterations if it reported doing nothing
+      // the last time it ran and no other optimizer has changed the graph
+      // since: rerunning it can only do nothing again. Optimizers signal
+      // "no change" through the Aborted convention in RunOptimizer.
+      auto last_run = last_run_info.find(optimizer->name());
+      if (iteration > 0 && last_run != last_run_info.end() &&
+          !last_run->second.first &&
+          last_run->second.second == graph_change_epoch) {
+        VLOG(3) << "Skipping " << optimizer->name() << " in iteration "
+                << iteration << ": no change last run and graph unchanged "
+                << "since.";
+        continue;
+      }
+
+      bool optimizer_changed_graph = true;
       TF_RETURN_IF_ERROR(RunOptimizer(optimizer.get(), cluster, &item,
-                                      optimized_graph, &optimization_result));
+                                      optimized_graph, &optimization_result,
+                                      &optimizer_changed_graph));
+      if (optimizer_changed_graph) ++graph_change_epoch;
+      last_run_info[optimizer->name()] = {optimizer_changed_graph,
+                                          graph_change_epoch};
 
       if (iteration == 0 && optimizer->name() == "model_pruner") {
         CompressConstants(optimized_graph);
@@ -782,7 +815,9 @@ Status MetaOptimizer::OptimizeGraph(Cluster* cluster, GrapplerItem&& item,
 
 Status MetaOptimizer::RunOptimizer(
     GraphOptimizer* optimizer, Cluster* cluster, GrapplerItem* optimized_item,
-    GraphDef* optimized_graph, GraphOptimizationResult* optimization_result) {
+    GraphDef* optimized_graph, GraphOptimizationResult* optimization_result,
+    bool* changed) {
+  if (changed != nullptr) *changed = true;
   // If optimizer doesn't need a function library, we will replace it with a
   // stub before running optimization, and will put it back at the end.
   std::unique_ptr<FunctionDefLibrary> optimized_graph_function_library;
@@ -820,6 +855,7 @@ Status MetaOptimizer::RunOptimizer(
                                 " did nothing. time = ", duration_ms, "ms.");
       // Swallow the non-critical error.
       status = Status::OK();
+      if (changed != nullptr) *changed = false;
     } else if (errors::IsDeadlineExceeded(status)) {
       message =
           strings::StrCat(status.ToString(), ", time = ", duration_ms, "ms.");
@@ -906,6 +942,60 @@ void PropagateTFDataAttrs(const FunctionLibraryDefinition& flib,
   }
 }
 
+namespace {
+
+// Persistent cache of optimized graphs, keyed by a fingerprint of the input
+// GraphDef, the rewriter configuration and the item's feed/fetch signature.
+// Enabled by TF_GRAPPLER_CACHE_DIR; repeated loads of an identical graph
+// skip the full optimization pipeline, while changed graphs simply miss.
+string GrapplerCachePath(const GrapplerItem& item, const RewriterConfig& config,
+                         const Cluster* cluster) {
+  static const char* cache_dir = std::getenv("TF_GRAPPLER_CACHE_DIR");
+  if (cache_dir == nullptr) return string();
+  // Grappler output is device-dependent (remapper, layout and other
+  // placement-sensitive rewrites), so the device configuration must be part
+  // of the key; without a cluster to describe it, caching is unsafe.
+  if (cluster == nullptr) return string();
+  string serialized_graph;
+  if (!SerializeToStringDeterministic(item.graph, &serialized_graph)) {
+    return string();
+  }
+  string serialized_config;
+  if (!SerializeToStringDeterministic(config, &serialized_config)) {
+    return string();
+  }
+  uint64 fp = Fingerprint64(serialized_graph);
+  fp = FingerprintCat64(fp, Fingerprint64(serialized_config));
+  for (const string& fetch : item.fetch) {
+    fp = FingerprintCat64(fp, Fingerprint64(fetch));
+  }
+  for (const auto& feed : item.feed) {
+    fp = FingerprintCat64(fp, Fingerprint64(feed.first));
+  }
+  // GetDevices() is an unordered map; sort the names so the fingerprint is
+  // deterministic across processes.
+  const auto& devices = cluster->GetDevices();
+  std::vector<string> device_names;
+  device_names.reserve(devices.size());
+  for (const auto& name_and_device : devices) {
+    device_names.push_back(name_and_device.first);
+  }
+  std::sort(device_names.begin(), device_names.end());
+  for (const string& device_name : device_names) {
+    fp = FingerprintCat64(fp, Fingerprint64(device_name));
+    string serialized_device;
+    if (!SerializeToStringDeterministic(devices.at(device_name),
+                                        &serialized_device)) {
+      return string();
+    }
+    fp = FingerprintCat64(fp, Fingerprint64(serialized_device));
+  }
+  return strings::Printf("%s/grappler_%016llx.pb", cache_dir,
+                         static_cast<unsigned long long>(fp));
+}
+
+}  // namespace
+
 Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster, GrapplerItem&& item,
                                           GraphDef* optimized_graph) {
   tensorflow::metrics::ScopedCounter<2> timings(
@@ -915,6 +1005,13 @@ Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster, GrapplerItem&& item,
   VLOG(1) << "Starting optimization for grappler item: " << item.id;
   optimization_results_.clear();
 
+  const string cache_path = GrapplerCachePath(item, cfg_, cluster);
+  if (!cache_path.empty() &&
+      ReadBinaryProto(Env::Default(), cache_path, optimized_graph).ok()) {
+    VLOG(1) << "Loaded optimized graph from " << cache_path;
+    return Status::OK();
+  }
+
   // Constructs a FunctionLibraryDefinition with functions that are reachable
   // from the nodes of the graph.
   const auto minimized_flib =
@@ -1145,6 +1242,21 @@ Status MetaOptimizer::OptimizeConsumeItem(Cluster* cluster, GrapplerItem&& item,
         *optimized_graph);
   }
 
+  if (!cache_path.empty()) {
+    // Write through a temp file so concurrent loads never observe a partial
+    // cache entry.
+    const string tmp_path = strings::StrCat(cache_path, ".tmp");
+    Status save_status =
+        WriteBinaryProto(Env::Default(), tmp_path, *optimized_graph);
+    if (save_status.ok()) {
+      save_status = Env::Default()->RenameFile(tmp_path, cache_path);
+    }
+    if (!save_status.ok()) {
+      LOG(WARNING) << "Failed to write grappler cache " << cache_path << ": "
+                   << save_status;
+    }
+  }
+
   return Status::OK();
 }
 
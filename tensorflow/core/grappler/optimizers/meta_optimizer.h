@@ -111,9 +111,12 @@ class MetaOptimizer : public GraphOptimizer {
     std::vector<OptimizerResult> results;
   };
 
+  // If `changed` is non-null, it is set to false when the optimizer reported
+  // doing nothing (the Aborted convention) and true otherwise.
   Status RunOptimizer(GraphOptimizer* optimizer, Cluster* cluster,
                       GrapplerItem* optimized_item, GraphDef* optimized_graph,
-                      GraphOptimizationResult* optimization_result);
+                      GraphOptimizationResult* optimization_result,
+                      bool* changed = nullptr);
 
   std::vector<GraphOptimizationResult> optimization_results_;
 };
@@ -1282,6 +1282,187 @@ bool FindMklLayerNorm(RemapperContext* ctx, int node_index,
   return found_op_type_match;
 }
 
+// Finds the standard primitive-op decomposition of layer normalization over
+// the last dimension, as produced by the non-fused Keras LayerNormalization
+// path via nn.batch_normalization:
+//
+//   mean     = Mean(x, axes, keep_dims=true)
+//   variance = Mean(SquaredDifference(x, mean), axes, keep_dims=true)
+//   inv      = Mul(Rsqrt(AddV2(variance, epsilon)), gamma)
+//   y        = AddV2(Mul(x, inv), Sub(beta, Mul(mean, inv)))
+//
+// Each of the eight ops makes a full memory pass; the fused kernel makes
+// one. CPU-only and float-only, matching the _FusedLayerNorm kernel.
+bool FindFusedLayerNorm(RemapperContext* ctx, int node_index,
+                        std::map<string, int>* matched_nodes_map,
+                        std::set<int>* remove_node_indices,
+                        float* epsilon) {
+  using utils::MatchingDirection;
+  using utils::NodeStatus;
+  // clang-format off
+  utils::OpTypePattern layer_norm_pattern =
+    {"AddV2", "output", NodeStatus::kReplace,
+      {
+        {"Mul", "scaled_input", NodeStatus::kRemove,
+          {
+            {"*", "input", NodeStatus::kRemain},
+            {"Mul", "inv_scale", NodeStatus::kRemove,
+              {
+                {"Rsqrt", "rsqrt", NodeStatus::kRemove,
+                  {
+                    {"AddV2", "var_plus_eps", NodeStatus::kRemove,
+                      {
+                        {"Mean", "variance", NodeStatus::kRemove,
+                          {
+                            {"SquaredDifference", "squared_diff",
+                             NodeStatus::kRemove,
+                              {
+                                {"*", "input2", NodeStatus::kRemain},
+                                {"Mean", "mean", NodeStatus::kRemove,
+                                  {
+                                    {"*", "input3", NodeStatus::kRemain},
+                                    {"Const", "mean_axes", NodeStatus::kRemain}
+                                  }
+                                }
+                              }
+                            },
+                            {"Const", "variance_axes", NodeStatus::kRemain}
+                          }
+                        },
+                        {"Const", "epsilon", NodeStatus::kRemain}
+                      }
+                    }
+                  }
+                },
+                {"*", "gamma", NodeStatus::kRemain}
+              }
+            }
+          }
+        },
+        {"Sub", "shifted_offset", NodeStatus::kRemove,
+          {
+            {"*", "beta", NodeStatus::kRemain},
+            {"Mul", "scaled_mean", NodeStatus::kRemove,
+              {
+                {"Mean", "mean2", NodeStatus::kRemove},
+                {"Mul", "inv_scale2", NodeStatus::kRemove}
+              }
+            }
+          }
+        }
+      }
+    };  // clang-format on
+
+  utils::SubGraphMatcher<MatchingDirection::kFollowInputs> graph_matcher(
+      &(ctx->graph_view));
+  matched_nodes_map->clear();
+  remove_node_indices->clear();
+  if (!graph_matcher.GetMatchedNodes(
+          layer_norm_pattern, ctx->nodes_to_preserve,
+          ctx->graph_view.GetNode(node_index), matched_nodes_map,
+          remove_node_indices)) {
+    return false;
+  }
+
+  auto node = [&](const char* label) {
+    return ctx->graph_view.GetNode(matched_nodes_map->at(label))->node();
+  };
+
+  // The pattern necessarily matched "mean"/"inv_scale" at several positions;
+  // they must be the same nodes. The three x uses are compared as full
+  // tensor ids (node:port) below, since a multi-output producer could feed
+  // different outputs into the mean and the scaled input.
+  if (node("mean") != node("mean2") ||
+      node("inv_scale") != node("inv_scale2")) {
+    return false;
+  }
+  const string& x_scaled = node("scaled_input")->input(0);
+  const string& x_squared_diff = node("squared_diff")->input(0);
+  const string& x_mean = node("mean")->input(0);
+  if (!IsSameInput(x_scaled, x_squared_diff) ||
+      !IsSameInput(x_scaled, x_mean)) {
+    return false;
+  }
+
+  const NodeDef* output_node = node("output");
+  if (!NodeIsOnCpu(output_node)) return false;
+  if (GetDataTypeFromAttr(*output_node, "T") != DT_FLOAT) return false;
+
+  // Both reductions must keep dims (so the subtract broadcasts correctly)
+  // and reduce exactly the last dimension.
+  for (const char* mean_label : {"mean", "variance"}) {
+    bool keep_dims = false;
+    if (!TryGetNodeAttr(*node(mean_label), "keep_dims", &keep_dims) ||
+        !keep_dims) {
+      return false;
+    }
+  }
+  Tensor mean_axes_t;
+  Tensor variance_axes_t;
+  if (!mean_axes_t.FromProto(
+          node("mean_axes")->attr().at("value").tensor()) ||
+      !variance_axes_t.FromProto(
+          node("variance_axes")->attr().at("value").tensor())) {
+    return false;
+  }
+  auto last_axis_only = [](const Tensor& axes) {
+    if (axes.NumElements() != 1) return false;
+    const int64_t axis = axes.dtype() == DT_INT64
+                             ? axes.flat<int64_t>()(0)
+                             : static_cast<int64_t>(axes.flat<int32>()(0));
+    return axis == -1;
+  };
+  if (!last_axis_only(mean_axes_t) || !last_axis_only(variance_axes_t)) {
+    return false;
+  }
+
+  Tensor epsilon_t;
+  if (!epsilon_t.FromProto(node("epsilon")->attr().at("value").tensor()) ||
+      epsilon_t.dtype() != DT_FLOAT || epsilon_t.NumElements() != 1) {
+    return false;
+  }
+  *epsilon = epsilon_t.flat<float>()(0);
+  return true;
+}
+
+Status AddFusedLayerNorm(RemapperContext* ctx,
+                         const std::map<string, int>& matched_nodes_map,
+                         const std::set<int>& remove_node_indices,
+                         float epsilon, std::vector<bool>* invalidated_nodes,
+                         std::vector<bool>* nodes_to_delete) {
+  auto* scaled_input_node =
+      ctx->graph_view.GetNode(matched_nodes_map.at("scaled_input"))->node();
+  auto* inv_scale_node =
+      ctx->graph_view.GetNode(matched_nodes_map.at("inv_scale"))->node();
+  auto* shifted_offset_node =
+      ctx->graph_view.GetNode(matched_nodes_map.at("shifted_offset"))->node();
+  auto* output_node =
+      ctx->graph_view.GetNode(matched_nodes_map.at("output"))->node();
+
+  NodeDef fused_node;
+  fused_node.set_name(output_node->name());
+  fused_node.set_op("_FusedLayerNorm");
+  fused_node.set_device(output_node->device());
+  fused_node.add_input(scaled_input_node->input(0));   // x
+  fused_node.add_input(inv_scale_node->input(1));      // gamma
+  fused_node.add_input(shifted_offset_node->input(0));  // beta
+  auto* attr = fused_node.mutable_attr();
+  (*attr)["T"] = output_node->attr().at("T");
+  SetAttrValue(epsilon, &(*attr)["epsilon"]);
+
+  utils::Mutation* mutation = ctx->graph_view.GetMutationBuilder();
+  Status status;
+  mutation->AddNode(std::move(fused_node), &status);
+  TF_RETURN_IF_ERROR(status);
+  TF_RETURN_IF_ERROR(mutation->Apply());
+  (*invalidated_nodes)[matched_nodes_map.at("output")] = true;
+
+  for (const auto& node_idx : remove_node_indices) {
+    (*nodes_to_delete)[node_idx] = true;
+  }
+  return Status::OK();
+}
+
 bool FindFusedBatchNorm(const RemapperContext& ctx, int node_index,
                         FusedBatchNorm* matched) {
   const auto* node_view = ctx.graph_view.GetNode(node_index);
@@ -3029,6 +3210,20 @@ Status Remapper::Optimize(Cluster* cluster, const GrapplerItem& item,
       }
     }
 
+    if (!item.optimization_options().is_eager_mode) {
+      // Remap the primitive-op layer-norm decomposition into _FusedLayerNorm.
+      std::map<string, int> ln_matched_nodes_map;
+      std::set<int> ln_remove_node_indices;
+      float ln_epsilon = 0.001;
+      if (FindFusedLayerNorm(&ctx, i, &ln_matched_nodes_map,
+                             &ln_remove_node_indices, &ln_epsilon)) {
+        TF_RETURN_IF_ERROR(AddFusedLayerNorm(
+            &ctx, ln_matched_nodes_map, ln_remove_node_indices, ln_epsilon,
+            &invalidated_nodes, &nodes_to_delete));
+        continue;
+      }
+    }
+
     // Infer properties lazily in case they are not needed.
     if (!ctx.inferred_graph_properties && RequiresInferredShapes(ctx, i)) {
       const bool assume_valid_feeds = opt_level_ == RewriterConfig::AGGRESSIVE;
@@ -111,6 +111,186 @@ TEST_F(RemapperTest, FusedBatchNormNCHW) {
   }
 }
 
+TEST_F(RemapperTest, FuseLayerNormFromPrimitives) {
+  using ::tensorflow::ops::Placeholder;
+
+  tensorflow::Scope s =
+      tensorflow::Scope::NewRootScope().WithDevice("/device:CPU:0");
+  Output dflt = ops::Const(s.WithOpName("dflt"),
+                           {1.0f, 2.0f, 4.0f, 8.0f, -1.0f, -3.0f}, {2, 3});
+  Output x = ops::PlaceholderWithDefault(s.WithOpName("x"), dflt, {2, 3});
+  Output gamma = ops::Const(s.WithOpName("gamma"), {0.5f, 1.0f, 2.0f}, {3});
+  Output beta = ops::Const(s.WithOpName("beta"), {0.1f, -0.1f, 0.3f}, {3});
+  Output axes = ops::Const(s.WithOpName("axes"), {-1}, {1});
+  Output epsilon = ops::Const(s.WithOpName("epsilon"), 0.001f, {});
+
+  // The standard nn.batch_normalization decomposition of layer norm:
+  //   y = x * (rsqrt(var + eps) * gamma) + (beta - mean * (rsqrt(...) *
+  //   gamma))
+  auto mean = ops::Mean(s.WithOpName("mean"), x, axes,
+                        ops::Mean::Attrs().KeepDims(true));
+  auto sq_diff =
+      ops::SquaredDifference(s.WithOpName("sq_diff"), x, mean);
+  auto variance = ops::Mean(s.WithOpName("variance"), sq_diff, axes,
+                            ops::Mean::Attrs().KeepDims(true));
+  auto var_plus_eps = ops::AddV2(s.WithOpName("var_plus_eps"), variance,
+                                 epsilon);
+  auto rsqrt = ops::Rsqrt(s.WithOpName("rsqrt"), var_plus_eps);
+  auto inv_scale = ops::Mul(s.WithOpName("inv_scale"), rsqrt, gamma);
+  auto scaled_input = ops::Mul(s.WithOpName("scaled_input"), x, inv_scale);
+  auto scaled_mean = ops::Mul(s.WithOpName("scaled_mean"), mean, inv_scale);
+  auto shifted_offset =
+      ops::Sub(s.WithOpName("shifted_offset"), beta, scaled_mean);
+  auto output =
+      ops::AddV2(s.WithOpName("output"), scaled_input, shifted_offset);
+
+  GrapplerItem item;
+  TF_ASSERT_OK(s.ToGraphDef(&item.graph));
+  item.fetch = {"output"};
+
+  auto tensors_expected = EvaluateNodes(item.graph, item.fetch);
+  ASSERT_EQ(tensors_expected.size(), 1);
+
+  Remapper optimizer(RewriterConfig::ON);
+  GraphDef optimized;
+  TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &optimized));
+
+  int found = 0;
+  for (const NodeDef& node : optimized.node()) {
+    if (node.name() == "output") {
+      EXPECT_EQ(node.op(), "_FusedLayerNorm");
+      ASSERT_EQ(node.input_size(), 3);
+      EXPECT_EQ(node.input(0), "x");
+      EXPECT_EQ(node.input(1), "gamma");
+      EXPECT_EQ(node.input(2), "beta");
+      EXPECT_NEAR(node.attr().at("epsilon").f(), 0.001f, 1e-9);
+      ++found;
+    }
+  }
+  EXPECT_EQ(found, 1);
+
+  auto tensors = EvaluateNodes(optimized, item.fetch);
+  ASSERT_EQ(tensors.size(), 1);
+  test::ExpectTensorNear<float>(tensors[0], tensors_expected[0], 1e-6);
+}
+
+TEST_F(RemapperTest, DoNotFuseLayerNormNonTrailingAxisOrNoKeepDims) {
+  using ::tensorflow::ops::Placeholder;
+
+  // Non-trailing reduction axis (with and without keep_dims); the trailing
+  // axis with keep_dims=true is the fusable form, and dropping keep_dims on
+  // the trailing axis would not broadcast, so axis 0 covers both negatives
+  // with valid graphs.
+  for (bool keep_dims : {true, false}) {
+    for (int axis : {0}) {
+      tensorflow::Scope s =
+          tensorflow::Scope::NewRootScope().WithDevice("/device:CPU:0");
+      Output dflt = ops::Const(s.WithOpName("dflt"),
+                               {1.0f, 2.0f, 4.0f, 8.0f, -1.0f, -3.0f}, {2, 3});
+      Output x = ops::PlaceholderWithDefault(s.WithOpName("x"), dflt, {2, 3});
+      const int inner = axis == -1 ? 3 : 2;
+      std::vector<float> ones(inner, 1.0f);
+      std::vector<float> zeros(inner, 0.0f);
+      Output gamma = ops::Const(s.WithOpName("gamma"), ones,
+                                TensorShape({inner}));
+      Output beta = ops::Const(s.WithOpName("beta"), zeros,
+                               TensorShape({inner}));
+      Output axes = ops::Const(s.WithOpName("axes"), {axis}, {1});
+      Output epsilon = ops::Const(s.WithOpName("epsilon"), 0.001f, {});
+
+      auto mean = ops::Mean(s.WithOpName("mean"), x, axes,
+                            ops::Mean::Attrs().KeepDims(keep_dims));
+      auto sq_diff =
+          ops::SquaredDifference(s.WithOpName("sq_diff"), x, mean);
+      auto variance = ops::Mean(s.WithOpName("variance"), sq_diff, axes,
+                                ops::Mean::Attrs().KeepDims(keep_dims));
+      auto var_plus_eps =
+          ops::AddV2(s.WithOpName("var_plus_eps"), variance, epsilon);
+      auto rsqrt = ops::Rsqrt(s.WithOpName("rsqrt"), var_plus_eps);
+      auto inv_scale = ops::Mul(s.WithOpName("inv_scale"), rsqrt, gamma);
+      auto scaled_input =
+          ops::Mul(s.WithOpName("scaled_input"), x, inv_scale);
+      auto scaled_mean =
+          ops::Mul(s.WithOpName("scaled_mean"), mean, inv_scale);
+      auto shifted_offset =
+          ops::Sub(s.WithOpName("shifted_offset"), beta, scaled_mean);
+      auto output =
+          ops::AddV2(s.WithOpName("output"), scaled_input, shifted_offset);
+
+      GrapplerItem item;
+      TF_ASSERT_OK(s.ToGraphDef(&item.graph));
+      item.fetch = {"output"};
+
+      Remapper optimizer(RewriterConfig::ON);
+      GraphDef optimized;
+      TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &optimized));
+
+      for (const NodeDef& node : optimized.node()) {
+        EXPECT_NE(node.op(), "_FusedLayerNorm")
+            << "keep_dims=" << keep_dims << " axis=" << axis;
+      }
+    }
+  }
+}
+
+TEST_F(RemapperTest, DoNotFuseLayerNormAcrossPortsOfOneProducer) {
+  using ::tensorflow::ops::Placeholder;
+
+  // All three x positions resolve to the same *node* (the Split), but the
+  // mean reduces a different *output port* than the scaled input uses, so
+  // this is not a layer norm and must not fuse.
+  tensorflow::Scope s =
+      tensorflow::Scope::NewRootScope().WithDevice("/device:CPU:0");
+  Output dflt = ops::Const(s.WithOpName("dflt"),
+                           {1.0f, 2.0f, 4.0f, 8.0f, -1.0f, -3.0f,
+                            2.0f, 6.0f, 0.0f, -2.0f, 5.0f, 7.0f},
+                           {4, 3});
+  Output x_all = ops::PlaceholderWithDefault(s.WithOpName("x_all"), dflt,
+                                             {4, 3});
+  auto split = ops::Split(s.WithOpName("split"), /*axis=*/0, x_all,
+                          /*num_split=*/2);
+  Output x = split[0];        // split:0
+  Output x_other = split[1];  // split:1
+  Output gamma = ops::Const(s.WithOpName("gamma"), {0.5f, 1.0f, 2.0f}, {3});
+  Output beta = ops::Const(s.WithOpName("beta"), {0.1f, -0.1f, 0.3f}, {3});
+  Output axes = ops::Const(s.WithOpName("axes"), {-1}, {1});
+  Output epsilon = ops::Const(s.WithOpName("epsilon"), 0.001f, {});
+
+  auto mean = ops::Mean(s.WithOpName("mean"), x_other, axes,
+                        ops::Mean::Attrs().KeepDims(true));
+  auto sq_diff = ops::SquaredDifference(s.WithOpName("sq_diff"), x, mean);
+  auto variance = ops::Mean(s.WithOpName("variance"), sq_diff, axes,
+                            ops::Mean::Attrs().KeepDims(true));
+  auto var_plus_eps =
+      ops::AddV2(s.WithOpName("var_plus_eps"), variance, epsilon);
+  auto rsqrt = ops::Rsqrt(s.WithOpName("rsqrt"), var_plus_eps);
+  auto inv_scale = ops::Mul(s.WithOpName("inv_scale"), rsqrt, gamma);
+  auto scaled_input = ops::Mul(s.WithOpName("scaled_input"), x, inv_scale);
+  auto scaled_mean = ops::Mul(s.WithOpName("scaled_mean"), mean, inv_scale);
+  auto shifted_offset =
+      ops::Sub(s.WithOpName("shifted_offset"), beta, scaled_mean);
+  auto output =
+      ops::AddV2(s.WithOpName("output"), scaled_input, shifted_offset);
+
+  GrapplerItem item;
+  TF_ASSERT_OK(s.ToGraphDef(&item.graph));
+  item.fetch = {"output"};
+
+  auto tensors_expected = EvaluateNodes(item.graph, item.fetch);
+  ASSERT_EQ(tensors_expected.size(), 1);
+
+  Remapper optimizer(RewriterConfig::ON);
+  GraphDef optimized;
+  TF_ASSERT_OK(optimizer.Optimize(nullptr, item, &optimized));
+
+  for (const NodeDef& node : optimized.node()) {
+    EXPECT_NE(node.op(), "_FusedLayerNorm");
+  }
+  auto tensors = EvaluateNodes(optimized, item.fetch);
+  ASSERT_EQ(tensors.size(), 1);
+  test::ExpectTensorNear<float>(tensors[0], tensors_expected[0], 1e-6);
+}
+
 TEST_F(RemapperTest, FuseBatchNormWithRelu) {
   using ::tensorflow::ops::Placeholder;
 
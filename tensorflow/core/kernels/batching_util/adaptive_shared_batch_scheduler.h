@@ -17,6 +17,7 @@ limitations under the License.
 #define TENSORFLOW_CORE_KERNELS_BATCHING_UTIL_ADAPTIVE_SHARED_BATCH_SCHEDULER_H_
 
 #include <algorithm>
+#include <cmath>
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -157,6 +158,18 @@ class AdaptiveSharedBatchScheduler
     // A non-zero value can improve performance by limiting the scheduling of
     // nearly empty batches.
     int64_t batch_timeout_micros = 0;
+
+    // If true, the per-batch close deadline is chosen from an online model
+    // of the arrival process instead of always using the full
+    // `batch_timeout_micros`: the queue tracks an EWMA of the inter-arrival
+    // gap and its variance, and a new batch's timeout is
+    //   min(batch_timeout_micros, 4 * (mean_gap + 2 * stddev_gap)),
+    // i.e. the batch stops waiting once the next few arrivals are
+    // statistically overdue. Under a steady stream the deadline tracks the
+    // actual arrival rate (cutting tail latency when traffic is faster than
+    // the static timeout assumed), while `batch_timeout_micros` remains the
+    // upper bound for slow or bursty periods.
+    bool adaptive_batch_timeout = false;
     // If non nullptr, split_input_task_func should split input_task into
     // multiple tasks, the first of which has size first_size and the remaining
     // not exceeding max_size. This function may acquire ownership of input_task
@@ -326,12 +339,22 @@ class ASBSQueue : public BatchScheduler<TaskType> {
   // Context id is reused after std::numeric_limits<uint64>::max is exhausted.
   static uint64 NewTraceMeContextIdForBatch();
 
+  // Records a task arrival at `now_micros` and returns the batch-close
+  // timeout a batch created now should use. See
+  // QueueOptions::adaptive_batch_timeout.
+  int64_t UpdateArrivalModelLocked(int64_t now_micros)
+      TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   std::shared_ptr<AdaptiveSharedBatchScheduler<TaskType>> scheduler_;
   const QueueOptions options_;
   // Owned by scheduler_.
   ASBSBatch<TaskType>* current_batch_ TF_GUARDED_BY(mu_) = nullptr;
   int64_t num_enqueued_batches_ TF_GUARDED_BY(mu_) = 0;
   int64_t num_enqueued_tasks_ TF_GUARDED_BY(mu_) = 0;
+  // Online arrival-process statistics for adaptive_batch_timeout.
+  int64_t last_arrival_micros_ TF_GUARDED_BY(mu_) = 0;
+  double arrival_gap_mean_micros_ TF_GUARDED_BY(mu_) = 0;
+  double arrival_gap_var_micros_ TF_GUARDED_BY(mu_) = 0;
   mutable mutex mu_;
   TF_DISALLOW_COPY_AND_ASSIGN(ASBSQueue);
 };
@@ -719,6 +742,34 @@ ASBSQueue<TaskType>::~ASBSQueue() {
   scheduler_->RemoveQueue(this);
 }
 
+template <typename TaskType>
+int64_t ASBSQueue<TaskType>::UpdateArrivalModelLocked(int64_t now_micros) {
+  // EWMA of inter-arrival gaps and their variance. The decay keeps roughly
+  // the last ~40 arrivals relevant, so the model adapts within a fraction of
+  // a second at serving rates while smoothing over jitter.
+  constexpr double kDecay = 0.05;
+  if (last_arrival_micros_ != 0 && now_micros > last_arrival_micros_) {
+    const double gap = static_cast<double>(now_micros - last_arrival_micros_);
+    if (arrival_gap_mean_micros_ == 0) {
+      arrival_gap_mean_micros_ = gap;
+    } else {
+      const double delta = gap - arrival_gap_mean_micros_;
+      arrival_gap_mean_micros_ += kDecay * delta;
+      arrival_gap_var_micros_ =
+          (1 - kDecay) * (arrival_gap_var_micros_ + kDecay * delta * delta);
+    }
+  }
+  last_arrival_micros_ = now_micros;
+  if (arrival_gap_mean_micros_ == 0) {
+    return options_.batch_timeout_micros;
+  }
+  const double stddev = std::sqrt(arrival_gap_var_micros_);
+  const double predicted =
+      4 * (arrival_gap_mean_micros_ + 2 * stddev);
+  return std::min<int64_t>(options_.batch_timeout_micros,
+                           static_cast<int64_t>(predicted));
+}
+
 template <typename TaskType>
 Status ASBSQueue<TaskType>::Schedule(std::unique_ptr<TaskType>* task) {
   size_t size = (*task)->size();
@@ -775,9 +826,13 @@ Status ASBSQueue<TaskType>::Schedule(std::unique_ptr<TaskType>* task) {
         // TraceMeConsumer.
         // When multiple calls to "ASBS::Schedule" accumulate to one batch, they
         // are processed in the same batch and should share traceme_context_id.
+        const int64_t now_micros = scheduler_->GetEnv()->NowMicros();
+        const int64_t timeout_micros =
+            options_.adaptive_batch_timeout
+                ? UpdateArrivalModelLocked(now_micros)
+                : options_.batch_timeout_micros;
         current_batch_ = new ASBSBatch<TaskType>(
-            this, scheduler_->GetEnv()->NowMicros(),
-            options_.batch_timeout_micros, NewTraceMeContextIdForBatch());
+            this, now_micros, timeout_micros, NewTraceMeContextIdForBatch());
         new_batches.push_back(current_batch_);
       }
 
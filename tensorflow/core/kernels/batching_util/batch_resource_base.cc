@@ -433,6 +433,17 @@ Status BatchResourceBase::ConcatInputTensors(
   const int num_inputs = batch.task(0).inputs.size();
   concatenated_tensors->reserve(num_inputs);
 
+  // Zero-concat fast path: a batch made of a single task that already has
+  // the padded batch size (common at low load, or when request batch sizes
+  // line up with allowed_batch_sizes) can forward its input tensors
+  // directly; there is nothing to assemble and nothing to pad.
+  if (batch.num_tasks() == 1 && padding_amount == 0) {
+    for (int i = 0; i < num_inputs; ++i) {
+      concatenated_tensors->push_back(batch.task(0).inputs.at(i));
+    }
+    return Status::OK();
+  }
+
   // Process each input one at a time (the typical case has just one).
   for (int i = 0; i < num_inputs; ++i) {
     // Concatenate the tasks ith input tensors into a big output tensor.
@@ -18,6 +18,7 @@ limitations under the License.
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <deque>
 #include <functional>
 #include <list>
@@ -165,6 +166,15 @@ class SharedBatchScheduler
     // avoid latency spikes.
     int64_t batch_timeout_micros = 0;
 
+    // Scheduling priority of this queue relative to its sibling queues on
+    // the same scheduler. When a batch thread becomes free, queues with a
+    // higher priority are offered it first (in descending priority order);
+    // equal-priority queues keep the fair round-robin order. Combined with a
+    // small `batch_timeout_micros`, this lets a latency-critical queue close
+    // partially-full batches and jump ahead of bulk queues that pad their
+    // batches to the maximum size.
+    int priority = 0;
+
     // The maximum allowable number of enqueued (accepted by Schedule() but
     // not yet being processed on a batch thread) tasks in terms of batches.
     // If this limit is reached, Schedule() will return an UNAVAILABLE error.
@@ -361,6 +371,9 @@ class Queue {
   // processed.
   bool IsEmpty() const;
 
+  // The scheduling priority of this queue; see QueueOptions::priority.
+  int priority() const { return options_.priority; }
+
   // Marks the queue closed, and waits until it is empty.
   void CloseAndWaitUntilEmpty();
 
@@ -665,6 +678,33 @@ void SharedBatchScheduler<TaskType>::GetNextWorkItem_Locked(
     BatchUniquePtr* batch_to_process_out) {
   BatchUniquePtr batch_to_process;
   internal::Queue<TaskType>* queue_for_batch = nullptr;
+
+  // Offer the thread to strictly-positive-priority queues first, in
+  // descending priority order, so a latency-critical queue's batch is picked
+  // up ahead of same-cycle bulk work. Queues left at the default priority
+  // are scheduled by the fair round-robin loop below.
+  std::vector<internal::Queue<TaskType>*> priority_queues;
+  for (const auto& queue : queues_) {
+    if (queue->priority() > 0) {
+      priority_queues.push_back(queue.get());
+    }
+  }
+  if (!priority_queues.empty()) {
+    std::stable_sort(priority_queues.begin(), priority_queues.end(),
+                     [](const internal::Queue<TaskType>* a,
+                        const internal::Queue<TaskType>* b) {
+                       return a->priority() > b->priority();
+                     });
+    for (internal::Queue<TaskType>* queue : priority_queues) {
+      batch_to_process = queue->ScheduleBatch();
+      if (!BatchExists(batch_to_process)) {
+        *queue_for_batch_out = queue;
+        *batch_to_process_out = std::move(batch_to_process);
+        return;
+      }
+    }
+  }
+
   const int num_queues = queues_.size();
   for (int num_queues_tried = 0;
        (BatchExists(batch_to_process)) && num_queues_tried < num_queues;
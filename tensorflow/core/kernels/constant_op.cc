@@ -24,6 +24,7 @@ limitations under the License.
 
 #include "tensorflow/core/kernels/constant_op.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
 #include "tensorflow/core/framework/allocator.h"
 #include "tensorflow/core/framework/bounds_check.h"
@@ -37,8 +38,11 @@ limitations under the License.
 #include "tensorflow/core/framework/variant_op_registry.h"
 #include "tensorflow/core/graph/graph_node_util.h"
 #include "tensorflow/core/kernels/fill_functor.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/profiler/lib/scoped_memory_debug_annotation.h"
+#include "tensorflow/core/util/env_var.h"
 
 namespace tensorflow {
 
@@ -70,6 +74,59 @@ NodeDef StripTensorDataFromNodeDef(OpKernelConstruction* ctx) {
   return ret;
 }
 
+// A process-wide content-addressed cache of host constant tensors, enabled by
+// setting TF_SHARE_CONSTANT_TENSORS=1. When several sessions load the same
+// model in one process, each Const kernel normally materializes its own copy
+// of the value; with the store enabled, kernels whose serialized TensorProto
+// has the same fingerprint share one immutable buffer via the Tensor
+// refcounting machinery. Shared buffers always have a refcount > 1, so the
+// runtime's buffer-forwarding optimizations never mutate them in place.
+//
+// Entries are retained for the lifetime of the process (that is the point:
+// the next session to load the model finds them), so only tensors of at
+// least kMinBytes are cached to keep the store from filling up with scalars.
+class SharedConstantStore {
+ public:
+  static SharedConstantStore* Global() {
+    static SharedConstantStore* store = new SharedConstantStore;
+    return store;
+  }
+
+  static bool IsEnabled() {
+    static const bool enabled = [] {
+      bool value = false;
+      Status status =
+          ReadBoolFromEnvVar("TF_SHARE_CONSTANT_TENSORS", false, &value);
+      if (!status.ok()) {
+        LOG(ERROR) << "SharedConstantStore: " << status.error_message();
+      }
+      return value;
+    }();
+    return enabled;
+  }
+
+  // Caching pays for itself only for weight-sized constants.
+  static constexpr int64_t kMinBytes = 4096;
+
+  bool Lookup(const Fprint128& fingerprint, Tensor* out) {
+    mutex_lock l(mu_);
+    auto it = tensors_.find(fingerprint);
+    if (it == tensors_.end()) return false;
+    *out = it->second;
+    return true;
+  }
+
+  void Insert(const Fprint128& fingerprint, const Tensor& tensor) {
+    mutex_lock l(mu_);
+    tensors_.emplace(fingerprint, tensor);
+  }
+
+ private:
+  mutex mu_;
+  absl::flat_hash_map<Fprint128, Tensor, Fprint128Hasher> tensors_
+      TF_GUARDED_BY(mu_);
+};
+
 }  // namespace
 
 ConstantOp::ConstantOp(OpKernelConstruction* ctx)
@@ -78,6 +135,31 @@ ConstantOp::ConstantOp(OpKernelConstruction* ctx)
   const TensorProto* proto = nullptr;
   profiler::ScopedMemoryDebugAnnotation op_annotation(name_view().data());
   OP_REQUIRES_OK(ctx, ctx->GetAttr("value", &proto));
+
+  // Share identical host constants across sessions when the store is
+  // enabled. Only CPU kernels participate: for other devices the tensor
+  // lives in device memory owned by that device's allocator.
+  const bool try_share = SharedConstantStore::IsEnabled() &&
+                         ctx->device_type() == DeviceType(DEVICE_CPU);
+  Fprint128 fingerprint;
+  string serialized;
+  if (try_share) {
+    if (proto->SerializeToString(&serialized) &&
+        serialized.size() >= SharedConstantStore::kMinBytes) {
+      fingerprint = Fingerprint128(serialized);
+      if (SharedConstantStore::Global()->Lookup(fingerprint, &tensor_)) {
+        OP_REQUIRES(ctx, ctx->output_type(0) == tensor_.dtype(),
+                    errors::InvalidArgument(
+                        "Type mismatch between value (",
+                        DataTypeString(tensor_.dtype()), ") and dtype (",
+                        DataTypeString(ctx->output_type(0)), ")"));
+        return;
+      }
+    } else {
+      serialized.clear();
+    }
+  }
+
   OP_REQUIRES_OK(ctx, ctx->device()->MakeTensorFromProto(
                           *proto, AllocatorAttributes(), &tensor_));
   OP_REQUIRES(
@@ -85,6 +167,9 @@ ConstantOp::ConstantOp(OpKernelConstruction* ctx)
       errors::InvalidArgument("Type mismatch between value (",
                               DataTypeString(tensor_.dtype()), ") and dtype (",
                               DataTypeString(ctx->output_type(0)), ")"));
+  if (try_share && !serialized.empty()) {
+    SharedConstantStore::Global()->Insert(fingerprint, tensor_);
+  }
 }
 
 void ConstantOp::Compute(OpKernelContext* ctx) {
@@ -88,6 +88,60 @@ void ConstantOpTest::PersistentMemoryTrackingTest(bool on_gpu) {
   }
 }
 
+TEST_F(ConstantOpTest, SharesIdenticalConstantsWhenEnabled) {
+  // This test must run before any other test in this binary constructs a
+  // Const kernel: the sharing gate is latched the first time a kernel
+  // checks it.
+  setenv("TF_SHARE_CONSTANT_TENSORS", "1", /*overwrite=*/1);
+
+  std::unique_ptr<Device> device(
+      DeviceFactory::NewDevice("CPU", {}, "/job:worker/replica:0/task:0"));
+
+  auto make_and_run = [&](const string& name, const Tensor& value,
+                          Tensor* out) {
+    NodeDef const_node;
+    TF_ASSERT_OK(NodeDefBuilder(name, "Const")
+                     .Attr("dtype", DT_INT32)
+                     .Attr("value", value)
+                     .Finalize(&const_node));
+    Status status;
+    std::unique_ptr<OpKernel> op(CreateOpKernel(DEVICE_CPU, device.get(),
+                                                cpu_allocator(), const_node,
+                                                TF_GRAPH_DEF_VERSION, &status));
+    TF_ASSERT_OK(status);
+    OpKernelContext::Params params;
+    params.device = device.get();
+    params.frame_iter = FrameAndIter(0, 0);
+    params.op_kernel = op.get();
+    OpKernelContext ctx(&params);
+    op->Compute(&ctx);
+    TF_ASSERT_OK(ctx.status());
+    *out = *ctx.mutable_output(0);
+  };
+
+  // 8KB of int32s: large enough to participate in sharing.
+  Tensor value(DT_INT32, TensorShape({2048}));
+  for (int i = 0; i < 2048; ++i) value.flat<int32>()(i) = i;
+
+  Tensor c1, c2;
+  make_and_run("c1", value, &c1);
+  make_and_run("c2", value, &c2);
+  // Two kernels built from the same value share one buffer, and the shared
+  // buffer still holds the right contents.
+  EXPECT_EQ(c1.tensor_data().data(), c2.tensor_data().data());
+  ASSERT_EQ(c2.NumElements(), 2048);
+  EXPECT_EQ(c2.flat<int32>()(0), 0);
+  EXPECT_EQ(c2.flat<int32>()(2047), 2047);
+
+  // A different value must not alias the stored one.
+  Tensor other(DT_INT32, TensorShape({2048}));
+  for (int i = 0; i < 2048; ++i) other.flat<int32>()(i) = i + 1;
+  Tensor c3;
+  make_and_run("c3", other, &c3);
+  EXPECT_NE(c1.tensor_data().data(), c3.tensor_data().data());
+  EXPECT_EQ(c3.flat<int32>()(0), 1);
+}
+
 TEST_F(ConstantOpTest, PersistentMemoryTracking) {
   PersistentMemoryTrackingTest(false);
 #if (defined(GOOGLE_CUDA) && GOOGLE_CUDA) || \
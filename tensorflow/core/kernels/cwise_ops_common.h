@@ -354,6 +354,73 @@ void Assign(const D& d, Out out, Rhs rhs) {
   out.device(d) = rhs;
 }
 
+// Fixed-extent evaluation of flat cwise expressions for a handful of hot
+// sizes. Inference graphs execute the same small (batch, depth) shapes
+// millions of times; giving the compiler a compile-time trip count yields
+// straight-line vector code and skips the device's runtime cost-model
+// dispatch. Falls back (returns false) for all other sizes.
+template <int N, typename Functor>
+void BinaryFixedSizeEval(typename Functor::tout_type out,
+                         typename Functor::tin_type in0,
+                         typename Functor::tin_type in1) {
+  typedef typename Functor::out_type Tout;
+  typedef typename Functor::in_type Tin;
+  Eigen::TensorMap<Eigen::TensorFixedSize<Tout, Eigen::Sizes<N>>> o(out.data());
+  Eigen::TensorMap<Eigen::TensorFixedSize<const Tin, Eigen::Sizes<N>>> a(
+      in0.data());
+  Eigen::TensorMap<Eigen::TensorFixedSize<const Tin, Eigen::Sizes<N>>> b(
+      in1.data());
+  o = a.binaryExpr(b, typename Functor::func());
+}
+
+template <typename Functor>
+bool BinaryFixedSizeDispatch(typename Functor::tout_type out,
+                             typename Functor::tin_type in0,
+                             typename Functor::tin_type in1) {
+  switch (out.size()) {
+    case 256:
+      BinaryFixedSizeEval<256, Functor>(out, in0, in1);
+      return true;
+    case 512:
+      BinaryFixedSizeEval<512, Functor>(out, in0, in1);
+      return true;
+    case 1024:
+      BinaryFixedSizeEval<1024, Functor>(out, in0, in1);
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <int N, typename Functor>
+void UnaryFixedSizeEval(typename Functor::tout_type out,
+                        typename Functor::tin_type in) {
+  typedef typename Functor::out_type Tout;
+  typedef typename Functor::in_type Tin;
+  Eigen::TensorMap<Eigen::TensorFixedSize<Tout, Eigen::Sizes<N>>> o(out.data());
+  Eigen::TensorMap<Eigen::TensorFixedSize<const Tin, Eigen::Sizes<N>>> a(
+      in.data());
+  o = a.unaryExpr(typename Functor::func());
+}
+
+template <typename Functor>
+bool UnaryFixedSizeDispatch(typename Functor::tout_type out,
+                            typename Functor::tin_type in) {
+  switch (out.size()) {
+    case 256:
+      UnaryFixedSizeEval<256, Functor>(out, in);
+      return true;
+    case 512:
+      UnaryFixedSizeEval<512, Functor>(out, in);
+      return true;
+    case 1024:
+      UnaryFixedSizeEval<1024, Functor>(out, in);
+      return true;
+    default:
+      return false;
+  }
+}
+
 // Partial specialization of BinaryFunctor<Device=CPUDevice, Functor, NDIMS>
 // for functors with no error checking.
 template <typename Functor, int NDIMS>
@@ -361,6 +428,7 @@ struct BinaryFunctor<CPUDevice, Functor, NDIMS, false> {
   void operator()(const CPUDevice& d, typename Functor::tout_type out,
                   typename Functor::tin_type in0,
                   typename Functor::tin_type in1, bool* error) {
+    if (BinaryFixedSizeDispatch<Functor>(out, in0, in1)) return;
     Assign(d, out, in0.binaryExpr(in1, typename Functor::func()));
   }
 
@@ -605,6 +673,7 @@ template <typename Functor>
 struct UnaryFunctor<CPUDevice, Functor> {
   void operator()(const CPUDevice& d, typename Functor::tout_type out,
                   typename Functor::tin_type in) {
+    if (UnaryFixedSizeDispatch<Functor>(out, in)) return;
     Assign(d, out, in.unaryExpr(typename Functor::func()));
   }
 };
@@ -14,6 +14,8 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/core/kernels/data/cache_ops.h"
 
+#include <cstring>
+
 #include "tensorflow/core/data/dataset_utils.h"
 #include "tensorflow/core/framework/dataset.h"
 #include "tensorflow/core/framework/partial_tensor_shape.h"
@@ -37,10 +39,57 @@ void MemoryCache::Complete(std::vector<std::vector<Tensor>>&& cache) {
   mutex_lock l(mu_);
   if (!completed_) {
     cache_ = std::move(cache);
+    MaybeCompact();
     completed_ = true;
   }
 }
 
+void MemoryCache::MaybeCompact() {
+  if (cache_.empty()) return;
+  const size_t num_elements = cache_.size();
+  const size_t num_components = cache_[0].size();
+
+  // Eligibility: all elements share each component's dtype and shape, every
+  // dtype is memcpy-able, and each component's row size preserves the
+  // allocator alignment so the aliased slices handed out by at() remain
+  // aligned tensors.
+  std::vector<size_t> row_bytes(num_components);
+  for (size_t c = 0; c < num_components; ++c) {
+    const Tensor& first = cache_[0][c];
+    if (!DataTypeCanUseMemcpy(first.dtype())) return;
+    row_bytes[c] = first.TotalBytes();
+    if (row_bytes[c] == 0 ||
+        row_bytes[c] % Allocator::kAllocatorAlignment != 0) {
+      return;
+    }
+  }
+  for (size_t e = 1; e < num_elements; ++e) {
+    if (cache_[e].size() != num_components) return;
+    for (size_t c = 0; c < num_components; ++c) {
+      if (cache_[e][c].dtype() != cache_[0][c].dtype() ||
+          cache_[e][c].shape() != cache_[0][c].shape()) {
+        return;
+      }
+    }
+  }
+
+  // Build one slab per component and re-point the cached elements at
+  // aliased slices of it.
+  for (size_t c = 0; c < num_components; ++c) {
+    TensorShape slab_shape({static_cast<int64_t>(num_elements)});
+    slab_shape.AppendShape(cache_[0][c].shape());
+    Tensor slab(cache_[0][c].dtype(), slab_shape);
+    char* dst = const_cast<char*>(slab.tensor_data().data());
+    for (size_t e = 0; e < num_elements; ++e) {
+      memcpy(dst + e * row_bytes[c], cache_[e][c].tensor_data().data(),
+             row_bytes[c]);
+    }
+    for (size_t e = 0; e < num_elements; ++e) {
+      cache_[e][c] = slab.SubSlice(e);
+    }
+  }
+}
+
 bool MemoryCache::IsCompleted() {
   tf_shared_lock l(mu_);
   return completed_;
@@ -51,6 +51,15 @@ class MemoryCache {
   const std::vector<std::vector<Tensor>>& data();
 
  private:
+  // Rewrites the cache in columnar form when eligible: each fixed-shape,
+  // memcpy-able component is concatenated into one contiguous slab tensor
+  // and elements become aliased slices of it. This collapses the per-element
+  // TensorBuffer allocations (one per component per element) into one buffer
+  // per component and gives replay sequential locality. Ineligible caches
+  // (varying shapes, non-POD dtypes, or rows that would break the slices'
+  // alignment) are left in row form.
+  void MaybeCompact() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   mutex mu_;
   // Determines whether all elements of the dataset have been cached.
   bool completed_ TF_GUARDED_BY(mu_) = false;
@@ -0,0 +1,182 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/core/data/dataset_test_base.h"
+
+namespace tensorflow {
+namespace data {
+namespace experimental {
+namespace {
+
+constexpr char kNodeName[] = "map_filter_batch_dataset";
+constexpr char kOpName[] = "MapFilterBatchDataset";
+
+class MapFilterBatchDatasetParams : public DatasetParams {
+ public:
+  template <typename T>
+  MapFilterBatchDatasetParams(T input_dataset_params, int64_t batch_size,
+                              bool drop_remainder,
+                              DataTypeVector output_dtypes,
+                              std::vector<PartialTensorShape> output_shapes,
+                              string node_name)
+      : DatasetParams(std::move(output_dtypes), std::move(output_shapes),
+                      std::move(node_name)),
+        batch_size_(batch_size),
+        drop_remainder_(drop_remainder) {
+    input_dataset_params_.push_back(absl::make_unique<T>(input_dataset_params));
+    iterator_prefix_ =
+        name_utils::IteratorPrefix(input_dataset_params.dataset_type(),
+                                   input_dataset_params.iterator_prefix());
+  }
+
+  std::vector<Tensor> GetInputTensors() const override {
+    return {CreateTensor<int64_t>(TensorShape({}), {batch_size_}),
+            CreateTensor<bool>(TensorShape({}), {drop_remainder_})};
+  }
+
+  Status GetInputNames(std::vector<string>* input_names) const override {
+    // The map function and predicate capture nothing in these tests, so the
+    // variadic other_arguments inputs are empty.
+    *input_names = {"input_dataset", "batch_size", "drop_remainder"};
+    return Status::OK();
+  }
+
+  Status GetAttributes(AttributeVector* attr_vector) const override {
+    *attr_vector = {
+        {"f", FunctionDefHelper::FunctionRef("XTimesTwo", {{"T", DT_INT64}})},
+        {"predicate",
+         FunctionDefHelper::FunctionRef("IsZero", {{"T", DT_INT64}})},
+        {"Targuments", DataTypeVector{}},
+        {"Tpredicate_arguments", DataTypeVector{}},
+        {"output_shapes", output_shapes_},
+        {"output_types", output_dtypes_},
+        {"metadata", ""}};
+    return Status::OK();
+  }
+
+  std::vector<FunctionDef> func_lib() const override {
+    return {test::function::XTimesTwo(), test::function::IsZero()};
+  }
+
+  string dataset_type() const override { return "MapFilterBatch"; }
+
+ private:
+  int64_t batch_size_;
+  bool drop_remainder_;
+};
+
+class MapFilterBatchDatasetOpTest : public DatasetOpsTestBase {};
+
+// Maps x -> 2x, keeps zeros, batches by 2 without dropping the remainder:
+// {0, 1, 2, 0, 3, 0} -> {0, 2, 4, 0, 6, 0} -> {0, 0, 0} -> {{0, 0}, {0}}.
+MapFilterBatchDatasetParams KeepRemainderParams() {
+  auto tensor_slice_dataset_params = TensorSliceDatasetParams(
+      /*components=*/
+      {CreateTensor<int64_t>(TensorShape{6, 1}, {0, 1, 2, 0, 3, 0})},
+      /*node_name=*/"tensor_slice_dataset");
+  return MapFilterBatchDatasetParams(
+      std::move(tensor_slice_dataset_params),
+      /*batch_size=*/2,
+      /*drop_remainder=*/false,
+      /*output_dtypes=*/{DT_INT64},
+      /*output_shapes=*/{PartialTensorShape({-1, 1})},
+      /*node_name=*/kNodeName);
+}
+
+// Same pipeline with drop_remainder=true: the trailing partial batch is
+// dropped.
+MapFilterBatchDatasetParams DropRemainderParams() {
+  auto tensor_slice_dataset_params = TensorSliceDatasetParams(
+      /*components=*/
+      {CreateTensor<int64_t>(TensorShape{6, 1}, {0, 1, 2, 0, 3, 0})},
+      /*node_name=*/"tensor_slice_dataset");
+  return MapFilterBatchDatasetParams(
+      std::move(tensor_slice_dataset_params),
+      /*batch_size=*/2,
+      /*drop_remainder=*/true,
+      /*output_dtypes=*/{DT_INT64},
+      /*output_shapes=*/{PartialTensorShape({2, 1})},
+      /*node_name=*/kNodeName);
+}
+
+// All elements filtered out: the iterator is immediately exhausted.
+MapFilterBatchDatasetParams AllFilteredParams() {
+  auto tensor_slice_dataset_params = TensorSliceDatasetParams(
+      /*components=*/
+      {CreateTensor<int64_t>(TensorShape{3, 1}, {1, 2, 3})},
+      /*node_name=*/"tensor_slice_dataset");
+  return MapFilterBatchDatasetParams(
+      std::move(tensor_slice_dataset_params),
+      /*batch_size=*/2,
+      /*drop_remainder=*/false,
+      /*output_dtypes=*/{DT_INT64},
+      /*output_shapes=*/{PartialTensorShape({-1, 1})},
+      /*node_name=*/kNodeName);
+}
+
+TEST_F(MapFilterBatchDatasetOpTest, KeepRemainder) {
+  auto params = KeepRemainderParams();
+  TF_ASSERT_OK(Initialize(params));
+  TF_ASSERT_OK(CheckIteratorGetNext(
+      {CreateTensor<int64_t>(TensorShape({2, 1}), {0, 0}),
+       CreateTensor<int64_t>(TensorShape({1, 1}), {0})},
+      /*compare_order=*/true));
+}
+
+TEST_F(MapFilterBatchDatasetOpTest, DropRemainder) {
+  auto params = DropRemainderParams();
+  TF_ASSERT_OK(Initialize(params));
+  TF_ASSERT_OK(CheckIteratorGetNext(
+      {CreateTensor<int64_t>(TensorShape({2, 1}), {0, 0})},
+      /*compare_order=*/true));
+}
+
+TEST_F(MapFilterBatchDatasetOpTest, AllElementsFiltered) {
+  auto params = AllFilteredParams();
+  TF_ASSERT_OK(Initialize(params));
+  TF_ASSERT_OK(CheckIteratorGetNext(std::vector<Tensor>{},
+                                    /*compare_order=*/true));
+}
+
+TEST_F(MapFilterBatchDatasetOpTest, DatasetNodeName) {
+  auto params = KeepRemainderParams();
+  TF_ASSERT_OK(Initialize(params));
+  TF_ASSERT_OK(CheckDatasetNodeName(params.node_name()));
+}
+
+TEST_F(MapFilterBatchDatasetOpTest, DatasetTypeString) {
+  auto params = KeepRemainderParams();
+  TF_ASSERT_OK(Initialize(params));
+  TF_ASSERT_OK(CheckDatasetTypeString(kOpName));
+}
+
+TEST_F(MapFilterBatchDatasetOpTest, Cardinality) {
+  // Filtering makes the cardinality unknowable.
+  auto params = KeepRemainderParams();
+  TF_ASSERT_OK(Initialize(params));
+  TF_ASSERT_OK(CheckDatasetCardinality(kUnknownCardinality));
+}
+
+TEST_F(MapFilterBatchDatasetOpTest, OutputDtypesAndShapes) {
+  auto params = KeepRemainderParams();
+  TF_ASSERT_OK(Initialize(params));
+  TF_ASSERT_OK(CheckDatasetOutputDtypes({DT_INT64}));
+  TF_ASSERT_OK(CheckDatasetOutputShapes({PartialTensorShape({-1, 1})}));
+}
+
+}  // namespace
+}  // namespace experimental
+}  // namespace data
+}  // namespace tensorflow
@@ -40,6 +40,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/lib/gtl/cleanup.h"
 #include "tensorflow/core/lib/random/random.h"
+#include "tensorflow/core/lib/strings/numbers.h"
 #include "tensorflow/core/lib/strings/strcat.h"
 #include "tensorflow/core/lib/strings/stringprintf.h"
 #include "tensorflow/core/platform/blocking_counter.h"
@@ -105,17 +106,45 @@ constexpr char kParallelInterleaveDatasetV2[] = "ParallelInterleaveDatasetV2";
 constexpr char kParallelInterleaveDatasetV3[] = "ParallelInterleaveDatasetV3";
 constexpr char kParallelInterleaveDatasetV4[] = "ParallelInterleaveDatasetV4";
 
-// `kCyclePrefetchFactor * cycle_length` is the default number of future cycle
-// elements that will be prefetched ahead of time. The purpose of prefetching
-// future cycle elements is to overlap expensive initialization (e.g. opening of
-// a remote file) with other computation.
+// `CyclePrefetchFactor() * cycle_length` is the default number of future
+// cycle elements that will be prefetched ahead of time. The purpose of
+// prefetching future cycle elements is to overlap expensive initialization
+// (e.g. opening of a remote file) with other computation.
 constexpr double kDefaultCyclePrefetchFactor = 2.0L;
 
-// `kPerIteratorPrefetchFactor * block_length + 1` is the default number of
+// `PerIteratorPrefetchFactor() * block_length + 1` is the default number of
 // per-iterator results that will be prefetched ahead of time. The `+ 1` is to
 // match the behavior of the original implementation.
 constexpr double kDefaultPerIteratorPrefetchFactor = 2.0L;
 
+// The prefetch depths determine how much a slow cycle element (e.g. a cold
+// remote file) can be overlapped with work on its siblings while results are
+// still emitted in deterministic order. Workloads with skewed shards can
+// deepen the speculation without rebuilding via these environment variables.
+double ReadFactorFromEnv(const char* name, double default_value) {
+  const char* value = getenv(name);
+  if (value == nullptr) return default_value;
+  double parsed;
+  if (!strings::safe_strtod(value, &parsed) || parsed < 0) {
+    LOG(WARNING) << "Ignoring invalid value for " << name << ": " << value;
+    return default_value;
+  }
+  return parsed;
+}
+
+double CyclePrefetchFactor() {
+  static const double factor = ReadFactorFromEnv(
+      "TF_DATA_INTERLEAVE_CYCLE_PREFETCH_FACTOR", kDefaultCyclePrefetchFactor);
+  return factor;
+}
+
+double PerIteratorPrefetchFactor() {
+  static const double factor =
+      ReadFactorFromEnv("TF_DATA_INTERLEAVE_PER_ITERATOR_PREFETCH_FACTOR",
+                        kDefaultPerIteratorPrefetchFactor);
+  return factor;
+}
+
 // Period between reporting dataset statistics.
 constexpr int kStatsReportingPeriodMillis = 1000;
 
@@ -128,7 +157,7 @@ int64_t ComputeBufferOutputElements(int64_t configured_buffer_output_elements,
   if (configured_buffer_output_elements != model::kAutotune) {
     return configured_buffer_output_elements;
   }
-  return kDefaultPerIteratorPrefetchFactor * block_length + 1;
+  return PerIteratorPrefetchFactor() * block_length + 1;
 }
 
 int64_t ComputePrefetchInputElements(int64_t configured_prefetch_input_elements,
@@ -136,7 +165,7 @@ int64_t ComputePrefetchInputElements(int64_t configured_prefetch_input_elements,
   if (configured_prefetch_input_elements != model::kAutotune) {
     return configured_prefetch_input_elements;
   }
-  return kDefaultCyclePrefetchFactor * cycle_length;
+  return CyclePrefetchFactor() * cycle_length;
 }
 
 int64_t OpVersionFromOpName(absl::string_view op_name) {
@@ -1697,7 +1726,7 @@ void ParallelInterleaveDatasetOp::MakeDataset(OpKernelContext* ctx,
       // If parallelism is to be autotuned, we set the cycle length so that
       // the number of thread created for the current and future cycle elements
       // roughly matches the number of schedulable cores.
-      const int num_threads_per_cycle_length = kDefaultCyclePrefetchFactor + 1;
+      const int num_threads_per_cycle_length = CyclePrefetchFactor() + 1;
       cycle_length =
           CeilDiv(port::MaxParallelism(), num_threads_per_cycle_length);
     }
@@ -15,12 +15,14 @@ limitations under the License.
 #include "tensorflow/core/kernels/data/shuffle_dataset_op.h"
 
 #include <cstdint>
+#include <cstring>
 #include <deque>
 #include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include "tensorflow/core/data/compression_utils.h"
 #include "tensorflow/core/data/dataset_utils.h"
 #include "tensorflow/core/data/name_utils.h"
 #include "tensorflow/core/data/serialization_utils.h"
@@ -28,6 +30,7 @@ limitations under the License.
 #include "tensorflow/core/framework/partial_tensor_shape.h"
 #include "tensorflow/core/framework/resource_mgr.h"
 #include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/variant.h"
 #include "tensorflow/core/kernels/data/random_seed_ops.h"
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/random/philox_random.h"
@@ -65,6 +68,20 @@ constexpr char kDataProduced[] = "data_produced";
 constexpr char kEndOfInputSequence[] = "end_of_input_sequence";
 constexpr char kEpoch[] = "epoch";
 constexpr char kNumElements[] = "num_elements";
+// When TF_DATA_SHUFFLE_COMPRESS_BUFFER=1, buffered elements are stored
+// snappy-compressed (as CompressedElement variants) and decompressed on the
+// way out. This trades CPU on both sides of the buffer for a several-fold
+// smaller resident shuffle buffer, which is what large-buffer recsys
+// workloads are limited by. The sampling distribution is unchanged: the
+// buffer still holds exactly the same window of elements.
+bool BufferCompressionEnabled() {
+  static const bool enabled = [] {
+    const char* value = getenv("TF_DATA_SHUFFLE_COMPRESS_BUFFER");
+    return value != nullptr && strcmp(value, "1") == 0;
+  }();
+  return enabled;
+}
+
 constexpr char kSlicesSize[] = "slices_size";
 constexpr char kSlicesStart[] = "slices_start";
 constexpr char kSlicesEnd[] = "slices_end";
@@ -232,6 +249,7 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
                 buffer_->at(slices_.front()->start % buffer_->size()));
       slices_.front()->start++;
       num_elements_--;
+      TF_RETURN_IF_ERROR(MaybeUncompressElement(out_tensors));
       return Status::OK();
     }
 
@@ -450,6 +468,55 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
       return Status::OK();
     }
 
+    // Returns true if buffered elements of this dataset may be stored
+    // compressed. Datasets whose real output is a single scalar variant are
+    // excluded so that a compressed element is always distinguishable from a
+    // genuine one (including across checkpoints).
+    bool ElementCompressionApplies() const {
+      const DataTypeVector& dtypes = dataset()->output_dtypes();
+      return BufferCompressionEnabled() &&
+             (dtypes.size() != 1 || dtypes[0] != DT_VARIANT);
+    }
+
+    // Compresses `element` in place into a single CompressedElement variant
+    // scalar if enabled; keeps the raw element on any failure.
+    void MaybeCompressElement(std::vector<Tensor>* element) const {
+      if (!ElementCompressionApplies()) {
+        return;
+      }
+      CompressedElement compressed;
+      if (!CompressElement(*element, &compressed).ok()) {
+        return;
+      }
+      Tensor holder(DT_VARIANT, TensorShape({}));
+      holder.scalar<Variant>()() = std::move(compressed);
+      element->clear();
+      element->push_back(std::move(holder));
+    }
+
+    // Reverses MaybeCompressElement. Applies independently of the current
+    // environment setting so that checkpoints written with compression on
+    // restore correctly either way.
+    Status MaybeUncompressElement(std::vector<Tensor>* element) const {
+      const DataTypeVector& dtypes = dataset()->output_dtypes();
+      if (dtypes.size() == 1 && dtypes[0] == DT_VARIANT) {
+        return Status::OK();
+      }
+      if (element->size() != 1 || (*element)[0].dtype() != DT_VARIANT ||
+          (*element)[0].dims() != 0) {
+        return Status::OK();
+      }
+      const CompressedElement* compressed =
+          (*element)[0].scalar<Variant>()().get<CompressedElement>();
+      if (compressed == nullptr) {
+        return Status::OK();
+      }
+      std::vector<Tensor> uncompressed;
+      TF_RETURN_IF_ERROR(UncompressElement(*compressed, &uncompressed));
+      *element = std::move(uncompressed);
+      return Status::OK();
+    }
+
     void AddToShuffleBuffer(IteratorContext* ctx, std::vector<Tensor>&& element)
         TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
       data_produced_ = true;
@@ -457,6 +524,7 @@ class ShuffleDatasetOpBase::ShuffleDatasetBase : public DatasetBase {
         VLOG(1) << "Starting to fill up shuffle buffer of size: "
                 << BufferSizeString();
       }
+      MaybeCompressElement(&element);
       this->RecordBufferEnqueue(ctx, element);
       size_t index = slices_.back()->end % buffer_->size();
       buffer_->at(index) = std::move(element);
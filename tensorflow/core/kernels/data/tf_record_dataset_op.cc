@@ -120,13 +120,21 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
       out_tensors->reserve(1);
       mutex_lock l(mu_);
       do {
-        // We are currently processing a file, so try to read the next record.
+        // We are currently processing a file, so try to read the next record,
+        // refilling the record buffer in bulk when it runs dry to amortize
+        // the reader's per-record overhead.
         if (reader_) {
-          out_tensors->emplace_back(ctx->allocator({}), DT_STRING,
-                                    TensorShape({}));
-          Status s =
-              reader_->ReadRecord(&out_tensors->back().scalar<tstring>()());
-          if (s.ok()) {
+          Status s = Status::OK();
+          if (next_buffered_record_ >= buffered_records_.size()) {
+            buffered_records_.clear();
+            next_buffered_record_ = 0;
+            s = reader_->ReadRecords(kReaderBufferSize, &buffered_records_);
+          }
+          if (s.ok() && next_buffered_record_ < buffered_records_.size()) {
+            out_tensors->emplace_back(ctx->allocator({}), DT_STRING,
+                                      TensorShape({}));
+            out_tensors->back().scalar<tstring>()() =
+                std::move(buffered_records_[next_buffered_record_++]);
             static monitoring::CounterCell* bytes_counter =
                 metrics::GetTFDataBytesReadCounter(kDatasetType);
             bytes_counter->IncrementBy(
@@ -134,8 +142,7 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
             *end_of_sequence = false;
             return Status::OK();
           }
-          out_tensors->pop_back();
-          if (!errors::IsOutOfRange(s)) {
+          if (!s.ok() && !errors::IsOutOfRange(s)) {
             // In case of other errors e.g., DataLoss, we still move forward
             // the file index so that it works with ignore_errors.
             // Otherwise the same file will repeat.
@@ -168,6 +175,17 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
         // We are currently processing a file, so try to skip reading
         // the next (num_to_skip - *num_skipped) record.
         if (reader_) {
+          // Consume any records already buffered before skipping in the
+          // underlying reader.
+          while (*num_skipped < num_to_skip &&
+                 next_buffered_record_ < buffered_records_.size()) {
+            ++next_buffered_record_;
+            ++*num_skipped;
+          }
+          if (*num_skipped == num_to_skip) {
+            *end_of_sequence = false;
+            return Status::OK();
+          }
           int last_num_skipped;
           Status s = reader_->SkipRecords(num_to_skip - *num_skipped,
                                           &last_num_skipped);
@@ -214,8 +232,16 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
                                              current_file_index_));
 
       if (reader_) {
-        TF_RETURN_IF_ERROR(
-            writer->WriteScalar(full_name(kOffset), reader_->TellOffset()));
+        // The persisted offset must point at the first unconsumed record,
+        // not past the records buffered ahead; each buffered record occupies
+        // header + payload + footer bytes in the (logical) stream.
+        uint64 offset = reader_->TellOffset();
+        for (size_t i = next_buffered_record_; i < buffered_records_.size();
+             ++i) {
+          offset -= io::RecordReader::kHeaderSize + buffered_records_[i].size() +
+                    io::RecordReader::kFooterSize;
+        }
+        TF_RETURN_IF_ERROR(writer->WriteScalar(full_name(kOffset), offset));
       }
       return Status::OK();
     }
@@ -259,11 +285,21 @@ class TFRecordDatasetOp::Dataset : public DatasetBase {
     void ResetStreamsLocked() TF_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
       reader_.reset();
       file_.reset();
+      buffered_records_.clear();
+      next_buffered_record_ = 0;
     }
 
+    // Number of records fetched from the reader per bulk refill.
+    static constexpr int64_t kReaderBufferSize = 32;
+
     mutex mu_;
     size_t current_file_index_ TF_GUARDED_BY(mu_) = 0;
 
+    // Records read ahead of consumption by the bulk refill, and the index of
+    // the first unconsumed one.
+    std::vector<tstring> buffered_records_ TF_GUARDED_BY(mu_);
+    size_t next_buffered_record_ TF_GUARDED_BY(mu_) = 0;
+
     // `reader_` will borrow the object that `file_` points to, so
     // we must destroy `reader_` before `file_`.
     std::unique_ptr<RandomAccessFile> file_ TF_GUARDED_BY(mu_);
@@ -146,7 +146,11 @@ class DecodeCSVOp : public OpKernel {
               output[f]->flat<float>()(i) = record_defaults[f].flat<float>()(0);
             } else {
               float value;
-              OP_REQUIRES(ctx, strings::safe_strtof(fields[f], &value),
+              // Plain decimals (the common CSV case) take the SWAR fast
+              // path; everything else falls back to the full parser.
+              OP_REQUIRES(ctx,
+                          strings::fast_strtof_plain(fields[f], &value) ||
+                              strings::safe_strtof(fields[f], &value),
                           errors::InvalidArgument(
                               "Field ", f, " in record ", i,
                               " is not a valid float: ", fields[f]));
@@ -166,7 +170,9 @@ class DecodeCSVOp : public OpKernel {
                   record_defaults[f].flat<double>()(0);
             } else {
               double value;
-              OP_REQUIRES(ctx, strings::safe_strtod(fields[f], &value),
+              OP_REQUIRES(ctx,
+                          strings::fast_strtod_plain(fields[f], &value) ||
+                              strings::safe_strtod(fields[f], &value),
                           errors::InvalidArgument(
                               "Field ", f, " in record ", i,
                               " is not a valid double: ", fields[f]));
@@ -105,20 +105,23 @@ class FingerprintOp : public OpKernel {
 
     if (input.dtype() == DT_STRING) {
       if (dim1 > 1) {
-        Tensor temp;
-        OP_REQUIRES_OK(context, context->allocate_temp(
-                                    DT_UINT8,
+        // The scratch matrix has shape {input.num_elements, fingerprint_size},
+        // and each row contains the fingerprint value of the corresponding
+        // string. To compute fingerprints of multiple strings, this op
+        // fingerprints the buffer containing the string fingerprints. Its
+        // backing allocation is retained across invocations by the pool.
+        ScratchBufferPool::ScopedScratch scratch;
+        OP_REQUIRES_OK(context, scratch_pool_.Get(
+                                    context, DT_UINT8,
                                     TensorShape{input.shape().num_elements(),
                                                 kFingerprintSize},
-                                    &temp));
-        // `temp` is a matrix of shape {input.num_elements, fingerprint_size},
-        // and each row contains the fingerprint value of corresponding string.
-        // To compute fingerprints of multiple strings, this op fingerprints the
-        // buffer containing the string fingerprints.
-        FarmhashFingerprint64(input.flat<tstring>(), temp.tensor<uint8, 2>());
-        FarmhashFingerprint64(static_cast<const Tensor&>(temp).shaped<uint8, 2>(
-                                  {dim0, dim1 * kFingerprintSize}),
-                              output->matrix<uint8>());
+                                    &scratch));
+        const Tensor& temp = *scratch.tensor();
+        FarmhashFingerprint64(input.flat<tstring>(),
+                              scratch.tensor()->tensor<uint8, 2>());
+        FarmhashFingerprint64(
+            temp.shaped<uint8, 2>({dim0, dim1 * kFingerprintSize}),
+            output->matrix<uint8>());
       } else {
         // In case dim1 == 1, each string computes into its own fingerprint
         // value. There is no need to fingerprint twice.
@@ -133,6 +136,9 @@ class FingerprintOp : public OpKernel {
 
  private:
   static constexpr int kFingerprintSize = sizeof(uint64);
+
+  // Retains the string-path scratch allocation across invocations.
+  ScratchBufferPool scratch_pool_;
 };
 
 REGISTER_KERNEL_BUILDER(Name("Fingerprint").Device(tensorflow::DEVICE_CPU),
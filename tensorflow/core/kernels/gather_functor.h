@@ -78,6 +78,20 @@ SliceIndex HandleCopies(OpKernelContext* ctx,
         port::prefetch<port::PREFETCH_HINT_T0>(
             &params(batch_idx, indices(i_next), 0));
         port::prefetch<port::PREFETCH_HINT_T0>(&out(batch_idx, i_next, 0));
+        // The one-ahead prefetch only hides the latency of rows that are
+        // already on their way; issue a deeper prefetch as well so that
+        // DRAM-resident rows of large (embedding-sized) tables are requested
+        // several iterations before their copy starts.
+        constexpr SliceIndex kPrefetchDistance = 8;
+        const SliceIndex i_ahead = indices_idx + kPrefetchDistance;
+        if (i_ahead < indices_size &&
+            (batch_idx < batch_idx_end || i_ahead < indices_idx_end)) {
+          const Index ahead_index = internal::SubtleMustCopy(indices(i_ahead));
+          if (FastBoundsCheck(ahead_index, limit)) {
+            port::prefetch<port::PREFETCH_HINT_T0>(
+                &params(batch_idx, ahead_index, 0));
+          }
+        }
         b_next = batch_idx;
       } else if (b_next <= batch_idx_end) {
         port::prefetch<port::PREFETCH_HINT_T0>(&params(b_next, indices(0), 0));
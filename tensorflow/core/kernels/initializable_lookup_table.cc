@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "tensorflow/core/kernels/initializable_lookup_table.h"
 
+#include "tensorflow/core/util/batch_util.h"
+
 #include "tensorflow/core/graph/graph_def_builder.h"
 #include "tensorflow/core/lib/core/errors.h"
 
@@ -88,9 +90,37 @@ Status InitializableLookupTable::Initialize(
     }
   }
   TF_RETURN_IF_ERROR(DoLazyPrepare([&iter]() { return iter.total_size(); }));
-  while (iter.Valid()) {
-    TF_RETURN_IF_ERROR(DoInsert(iter.keys(), iter.values()));
-    iter.Next();
+  // Iterators that yield one scalar pair per step (e.g. text-file vocab
+  // loaders) would otherwise pay a full DoInsert round-trip per entry; batch
+  // them into chunks so the per-call overhead amortizes across thousands of
+  // entries. Iterators that already yield batched tensors keep the direct
+  // path.
+  const bool scalar_iterator =
+      iter.Valid() && iter.keys().dims() == 0 && iter.values().dims() == 0;
+  if (scalar_iterator) {
+    constexpr int64_t kInsertBatchSize = 4096;
+    Tensor key_batch(iter.keys().dtype(), TensorShape({kInsertBatchSize}));
+    Tensor value_batch(iter.values().dtype(), TensorShape({kInsertBatchSize}));
+    while (iter.Valid()) {
+      int64_t n = 0;
+      while (iter.Valid() && n < kInsertBatchSize) {
+        TF_RETURN_IF_ERROR(
+            batch_util::CopyElementToSlice(iter.keys(), &key_batch, n));
+        TF_RETURN_IF_ERROR(
+            batch_util::CopyElementToSlice(iter.values(), &value_batch, n));
+        ++n;
+        iter.Next();
+      }
+      if (n > 0) {
+        TF_RETURN_IF_ERROR(
+            DoInsert(key_batch.Slice(0, n), value_batch.Slice(0, n)));
+      }
+    }
+  } else {
+    while (iter.Valid()) {
+      TF_RETURN_IF_ERROR(DoInsert(iter.keys(), iter.values()));
+      iter.Next();
+    }
   }
   if (!errors::IsOutOfRange(iter.status())) {
     return iter.status();
@@ -0,0 +1,117 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include <cmath>
+#include <vector>
+
+#include "tensorflow/core/framework/fake_input.h"
+#include "tensorflow/core/framework/node_def_builder.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_testutil.h"
+#include "tensorflow/core/kernels/ops_testutil.h"
+#include "tensorflow/core/lib/core/status_test_util.h"
+#include "tensorflow/core/platform/test.h"
+
+namespace tensorflow {
+namespace {
+
+class FusedLayerNormOpTest : public OpsTestBase {
+ protected:
+  void MakeOp(float epsilon) {
+    TF_EXPECT_OK(NodeDefBuilder("layer_norm", "_FusedLayerNorm")
+                     .Input(FakeInput(DT_FLOAT))
+                     .Input(FakeInput(DT_FLOAT))
+                     .Input(FakeInput(DT_FLOAT))
+                     .Attr("epsilon", epsilon)
+                     .Finalize(node_def()));
+    TF_EXPECT_OK(InitOp());
+  }
+
+  // Unfused reference: y = (x - mean) * rsqrt(var + eps) * gamma + beta,
+  // normalized over the last dimension.
+  static std::vector<float> Reference(const std::vector<float>& x,
+                                      const std::vector<float>& gamma,
+                                      const std::vector<float>& beta,
+                                      int depth, float epsilon) {
+    std::vector<float> y(x.size());
+    const int rows = x.size() / depth;
+    for (int r = 0; r < rows; ++r) {
+      double mean = 0;
+      for (int c = 0; c < depth; ++c) mean += x[r * depth + c];
+      mean /= depth;
+      double var = 0;
+      for (int c = 0; c < depth; ++c) {
+        const double d = x[r * depth + c] - mean;
+        var += d * d;
+      }
+      var /= depth;
+      const double inv = 1.0 / std::sqrt(var + epsilon);
+      for (int c = 0; c < depth; ++c) {
+        y[r * depth + c] =
+            (x[r * depth + c] - mean) * inv * gamma[c] + beta[c];
+      }
+    }
+    return y;
+  }
+};
+
+TEST_F(FusedLayerNormOpTest, MatchesUnfusedReference) {
+  constexpr float kEpsilon = 0.001f;
+  MakeOp(kEpsilon);
+  const std::vector<float> x = {1.0f, 2.0f,  4.0f,  8.0f,
+                                -1.0f, -3.0f, 0.5f, 10.0f};
+  const std::vector<float> gamma = {0.5f, 1.0f, 2.0f, 1.5f};
+  const std::vector<float> beta = {0.1f, -0.1f, 0.3f, 0.0f};
+  AddInputFromArray<float>(TensorShape({2, 4}), x);
+  AddInputFromArray<float>(TensorShape({4}), gamma);
+  AddInputFromArray<float>(TensorShape({4}), beta);
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({2, 4}));
+  test::FillValues<float>(&expected, Reference(x, gamma, beta, 4, kEpsilon));
+  test::ExpectTensorNear<float>(expected, *GetOutput(0), 1e-5);
+}
+
+TEST_F(FusedLayerNormOpTest, HigherRankNormalizesLastDimension) {
+  constexpr float kEpsilon = 0.01f;
+  MakeOp(kEpsilon);
+  std::vector<float> x(2 * 3 * 4);
+  for (size_t i = 0; i < x.size(); ++i) {
+    x[i] = 0.25f * static_cast<float>(i) - 2.0f;
+  }
+  const std::vector<float> gamma = {1.0f, 2.0f, 0.5f, 1.0f};
+  const std::vector<float> beta = {0.0f, 1.0f, -1.0f, 0.5f};
+  AddInputFromArray<float>(TensorShape({2, 3, 4}), x);
+  AddInputFromArray<float>(TensorShape({4}), gamma);
+  AddInputFromArray<float>(TensorShape({4}), beta);
+  TF_ASSERT_OK(RunOpKernel());
+
+  Tensor expected(allocator(), DT_FLOAT, TensorShape({2, 3, 4}));
+  test::FillValues<float>(&expected, Reference(x, gamma, beta, 4, kEpsilon));
+  test::ExpectTensorNear<float>(expected, *GetOutput(0), 1e-5);
+}
+
+TEST_F(FusedLayerNormOpTest, RejectsMismatchedScaleSize) {
+  MakeOp(0.001f);
+  AddInputFromArray<float>(TensorShape({2, 4}),
+                           {1, 2, 3, 4, 5, 6, 7, 8});
+  AddInputFromArray<float>(TensorShape({3}), {1, 1, 1});
+  AddInputFromArray<float>(TensorShape({4}), {0, 0, 0, 0});
+  const Status s = RunOpKernel();
+  EXPECT_FALSE(s.ok());
+}
+
+}  // namespace
+}  // namespace tensorflow
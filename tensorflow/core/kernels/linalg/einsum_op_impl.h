@@ -39,6 +39,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/gtl/inlined_vector.h"
 #include "tensorflow/core/lib/math/math_util.h"
+#include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/profiler/lib/traceme.h"
 #include "tensorflow/core/util/einsum_op_util.h"
@@ -604,18 +605,56 @@ class EinsumOp : public OpKernel {
     OpInputList inputs;
     OP_REQUIRES_OK(ctx, ctx->input_list("inputs", &inputs));
 
-    OperandLabels input_labels(input_labels_);
-    Labels output_labels(output_labels_);
-    std::vector<EinsumHelper::DimensionType> label_types(label_types_);
-    OperandLabelCounts input_label_counts(input_label_counts_);
-    LabelCounts output_label_counts(output_label_counts_);
+    OperandLabels input_labels;
+    Labels output_labels;
+    std::vector<EinsumHelper::DimensionType> label_types;
+    OperandLabelCounts input_label_counts;
+    LabelCounts output_label_counts;
     LabelToDimSizes label_to_dim_sizes;
 
-    OP_REQUIRES_OK(ctx, EinsumHelper::ProcessDimensions(
-                            inputs, input_has_ellipsis_, output_has_ellipsis_,
-                            &input_labels, &output_labels, &label_types,
-                            &input_label_counts, &output_label_counts,
-                            &label_to_dim_sizes));
+    // Steady-state inference calls the same einsum with the same shapes over
+    // and over; the shape-dependent planning (ellipsis resolution, label
+    // bookkeeping, dimension checks) is memoized per kernel instance and
+    // keyed by the input shapes.
+    gtl::InlinedVector<TensorShape, 2> input_shapes;
+    input_shapes.reserve(inputs.size());
+    for (int i = 0; i < inputs.size(); ++i) {
+      input_shapes.push_back(inputs[i].shape());
+    }
+    bool plan_cached = false;
+    {
+      mutex_lock l(plan_mu_);
+      if (cached_plan_valid_ && cached_plan_input_shapes_ == input_shapes) {
+        input_labels = cached_plan_.input_labels;
+        output_labels = cached_plan_.output_labels;
+        label_types = cached_plan_.label_types;
+        input_label_counts = cached_plan_.input_label_counts;
+        output_label_counts = cached_plan_.output_label_counts;
+        label_to_dim_sizes = cached_plan_.label_to_dim_sizes;
+        plan_cached = true;
+      }
+    }
+    if (!plan_cached) {
+      input_labels = input_labels_;
+      output_labels = output_labels_;
+      label_types = label_types_;
+      input_label_counts = input_label_counts_;
+      output_label_counts = output_label_counts_;
+      OP_REQUIRES_OK(ctx, EinsumHelper::ProcessDimensions(
+                              inputs, input_has_ellipsis_, output_has_ellipsis_,
+                              &input_labels, &output_labels, &label_types,
+                              &input_label_counts, &output_label_counts,
+                              &label_to_dim_sizes));
+      mutex_lock l(plan_mu_);
+      cached_plan_input_shapes_ = std::move(input_shapes);
+      cached_plan_.input_labels = input_labels;
+      cached_plan_.output_labels = output_labels;
+      cached_plan_.label_types = label_types;
+      cached_plan_.input_label_counts = input_label_counts;
+      cached_plan_.output_label_counts = output_label_counts;
+      cached_plan_.label_to_dim_sizes = label_to_dim_sizes;
+      cached_plan_valid_ = true;
+    }
 
     // The reduction phase (a) sums across reduction dimensions, (b) takes
     // generalized diagonals, and (c) reshapes it into shape
@@ -730,6 +769,22 @@ class EinsumOp : public OpKernel {
   }
 
  private:
+  // Shape-dependent planning state memoized across calls; see Compute.
+  struct CachedPlan {
+    OperandLabels input_labels;
+    Labels output_labels;
+    std::vector<EinsumHelper::DimensionType> label_types;
+    OperandLabelCounts input_label_counts;
+    LabelCounts output_label_counts;
+    LabelToDimSizes label_to_dim_sizes;
+  };
+
+  mutex plan_mu_;
+  bool cached_plan_valid_ TF_GUARDED_BY(plan_mu_) = false;
+  gtl::InlinedVector<TensorShape, 2> cached_plan_input_shapes_
+      TF_GUARDED_BY(plan_mu_);
+  CachedPlan cached_plan_ TF_GUARDED_BY(plan_mu_);
+
   string equation_;
   OperandLabels input_labels_;
   Labels output_labels_;
@@ -0,0 +1,232 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+// Portable CPU kernel for QuantizedDepthwiseConv2D. The oneDNN build carries
+// labeled kernels for these ops; without oneDNN (common on edge servers)
+// they previously had no CPU kernel at all.
+
+#define EIGEN_USE_THREADS
+
+#include <vector>
+
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/framework/tensor_shape.h"
+#include "tensorflow/core/kernels/quantization_utils.h"
+#include "tensorflow/core/util/padding.h"
+#include "tensorflow/core/util/tensor_format.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+// Depthwise convolution on quantized values with 32-bit accumulation.
+// Layouts are NHWC for the input and [filter_rows, filter_cols, in_depth,
+// depth_multiplier] for the filter, so the inner accumulation loop runs over
+// the contiguous channel dimension and auto-vectorizes to the platform's
+// widest integer instructions.
+template <class Tinput, class Tfilter>
+class QuantizedDepthwiseConv2DOp : public OpKernel {
+ public:
+  explicit QuantizedDepthwiseConv2DOp(OpKernelConstruction* context)
+      : OpKernel(context) {
+    OP_REQUIRES_OK(context, context->GetAttr("strides", &strides_));
+    OP_REQUIRES(context, strides_.size() == 4,
+                errors::InvalidArgument("Sliding window strides field must "
+                                        "specify 4 dimensions"));
+    OP_REQUIRES(context, strides_[1] == strides_[2],
+                errors::InvalidArgument(
+                    "Current implementation only supports equal length "
+                    "strides in the row and column dimensions."));
+    OP_REQUIRES(
+        context, (strides_[0] == 1 && strides_[3] == 1),
+        errors::InvalidArgument("Current implementation does not yet support "
+                                "strides in the batch and depth dimensions."));
+    std::vector<int32> dilations;
+    OP_REQUIRES_OK(context, context->GetAttr("dilations", &dilations));
+    OP_REQUIRES(context,
+                dilations.size() == 4 && dilations[0] == 1 &&
+                    dilations[1] == 1 && dilations[2] == 1 && dilations[3] == 1,
+                errors::InvalidArgument(
+                    "Current implementation only supports dilation rate 1."));
+    OP_REQUIRES_OK(context, context->GetAttr("padding", &padding_));
+  }
+
+  void Compute(OpKernelContext* context) override {
+    const Tensor& input = context->input(0);
+    const Tensor& filter = context->input(1);
+    OP_REQUIRES(context, input.dims() == 4,
+                errors::InvalidArgument("input must be 4-dimensional",
+                                        input.shape().DebugString()));
+    OP_REQUIRES(context, filter.dims() == 4,
+                errors::InvalidArgument("filter must be 4-dimensional: ",
+                                        filter.shape().DebugString()));
+
+    const float min_input = context->input(2).flat<float>()(0);
+    const float max_input = context->input(3).flat<float>()(0);
+    const float min_filter = context->input(4).flat<float>()(0);
+    const float max_filter = context->input(5).flat<float>()(0);
+    const int32_t offset_input =
+        FloatToQuantizedUnclamped<Tinput>(0.0f, min_input, max_input);
+    const int32_t offset_filter =
+        FloatToQuantizedUnclamped<Tfilter>(0.0f, min_filter, max_filter);
+
+    const int64_t in_depth = input.dim_size(3);
+    OP_REQUIRES(context, in_depth == filter.dim_size(2),
+                errors::InvalidArgument(
+                    "input and filter must have the same depth: ", in_depth,
+                    " vs ", filter.dim_size(2)));
+    const int64_t depth_multiplier = filter.dim_size(3);
+    const int64_t out_depth = in_depth * depth_multiplier;
+
+    const int64_t input_rows = input.dim_size(1);
+    const int64_t input_cols = input.dim_size(2);
+    const int64_t filter_rows = filter.dim_size(0);
+    const int64_t filter_cols = filter.dim_size(1);
+    const int64_t batch = input.dim_size(0);
+    const int stride = strides_[1];
+
+    int64_t out_rows = 0, out_cols = 0, pad_rows = 0, pad_cols = 0;
+    OP_REQUIRES_OK(context,
+                   GetWindowedOutputSize(input_rows, filter_rows, stride,
+                                         padding_, &out_rows, &pad_rows));
+    OP_REQUIRES_OK(context,
+                   GetWindowedOutputSize(input_cols, filter_cols, stride,
+                                         padding_, &out_cols, &pad_cols));
+    TensorShape out_shape({batch, out_rows, out_cols, out_depth});
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(context, context->allocate_output(0, out_shape, &output));
+
+    const Tinput* input_data = input.flat<Tinput>().data();
+    const Tfilter* filter_data = filter.flat<Tfilter>().data();
+    qint32* output_data = output->flat<qint32>().data();
+
+    auto compute_rows = [&](int64_t start, int64_t end) {
+      for (int64_t work = start; work < end; ++work) {
+        const int64_t b = work / out_rows;
+        const int64_t out_y = work % out_rows;
+        const int64_t in_y_origin = out_y * stride - pad_rows;
+        const Tinput* batch_input =
+            input_data + b * input_rows * input_cols * in_depth;
+        for (int64_t out_x = 0; out_x < out_cols; ++out_x) {
+          const int64_t in_x_origin = out_x * stride - pad_cols;
+          int32_t* out_pixel = reinterpret_cast<int32_t*>(
+              output_data +
+              ((b * out_rows + out_y) * out_cols + out_x) * out_depth);
+          for (int64_t d = 0; d < out_depth; ++d) {
+            out_pixel[d] = 0;
+          }
+          for (int64_t filter_y = 0; filter_y < filter_rows; ++filter_y) {
+            const int64_t in_y = in_y_origin + filter_y;
+            if (in_y < 0 || in_y >= input_rows) {
+              // Zero padding contributes (0 - offset_input) * filter terms.
+              for (int64_t filter_x = 0; filter_x < filter_cols; ++filter_x) {
+                AccumulatePadding(filter_data, filter_y, filter_x, in_depth,
+                                  depth_multiplier, filter_cols, offset_input,
+                                  offset_filter, out_pixel);
+              }
+              continue;
+            }
+            for (int64_t filter_x = 0; filter_x < filter_cols; ++filter_x) {
+              const int64_t in_x = in_x_origin + filter_x;
+              if (in_x < 0 || in_x >= input_cols) {
+                AccumulatePadding(filter_data, filter_y, filter_x, in_depth,
+                                  depth_multiplier, filter_cols, offset_input,
+                                  offset_filter, out_pixel);
+                continue;
+              }
+              const Tinput* in_pixel =
+                  batch_input + (in_y * input_cols + in_x) * in_depth;
+              const Tfilter* filter_pixel =
+                  filter_data + (filter_y * filter_cols + filter_x) * in_depth *
+                                    depth_multiplier;
+              // Contiguous over channels; auto-vectorizes.
+              for (int64_t c = 0; c < in_depth; ++c) {
+                const int32_t in_value =
+                    static_cast<int32_t>(in_pixel[c]) - offset_input;
+                for (int64_t m = 0; m < depth_multiplier; ++m) {
+                  const int32_t filter_value =
+                      static_cast<int32_t>(
+                          filter_pixel[c * depth_multiplier + m]) -
+                      offset_filter;
+                  out_pixel[c * depth_multiplier + m] += in_value * filter_value;
+                }
+              }
+            }
+          }
+        }
+      }
+    };
+
+    auto worker_threads = *(context->device()->tensorflow_cpu_worker_threads());
+    const int64_t cost_per_row =
+        out_cols * out_depth * filter_rows * filter_cols * 2;
+    Shard(worker_threads.num_threads, worker_threads.workers, batch * out_rows,
+          cost_per_row, compute_rows);
+
+    float min_output_value;
+    float max_output_value;
+    QuantizationRangeForMultiplication<Tinput, Tfilter, qint32>(
+        min_input, max_input, min_filter, max_filter, &min_output_value,
+        &max_output_value);
+    Tensor* output_min = nullptr;
+    OP_REQUIRES_OK(context, context->allocate_output(1, {}, &output_min));
+    output_min->flat<float>()(0) = min_output_value;
+    Tensor* output_max = nullptr;
+    OP_REQUIRES_OK(context, context->allocate_output(2, {}, &output_max));
+    output_max->flat<float>()(0) = max_output_value;
+  }
+
+ private:
+  // Adds the contribution of one zero-padded input pixel: every padded tap
+  // contributes (0 - offset_input) * (filter - offset_filter).
+  static void AccumulatePadding(const Tfilter* filter_data, int64_t filter_y,
+                                int64_t filter_x, int64_t in_depth,
+                                int64_t depth_multiplier, int64_t filter_cols,
+                                int32_t offset_input, int32_t offset_filter,
+                                int32_t* out_pixel) {
+    if (offset_input == 0) {
+      // Zero is exactly representable; padded taps contribute nothing.
+      return;
+    }
+    const Tfilter* filter_pixel =
+        filter_data +
+        (filter_y * filter_cols + filter_x) * in_depth * depth_multiplier;
+    const int64_t out_depth = in_depth * depth_multiplier;
+    for (int64_t d = 0; d < out_depth; ++d) {
+      const int32_t filter_value =
+          static_cast<int32_t>(filter_pixel[d]) - offset_filter;
+      out_pixel[d] += (0 - offset_input) * filter_value;
+    }
+  }
+
+  std::vector<int32> strides_;
+  Padding padding_;
+};
+
+REGISTER_KERNEL_BUILDER(Name("QuantizedDepthwiseConv2D")
+                            .Device(DEVICE_CPU)
+                            .TypeConstraint<quint8>("Tinput")
+                            .TypeConstraint<qint8>("Tfilter")
+                            .TypeConstraint<qint32>("out_type"),
+                        QuantizedDepthwiseConv2DOp<quint8, qint8>);
+
+REGISTER_KERNEL_BUILDER(Name("QuantizedDepthwiseConv2D")
+                            .Device(DEVICE_CPU)
+                            .TypeConstraint<quint8>("Tinput")
+                            .TypeConstraint<quint8>("Tfilter")
+                            .TypeConstraint<qint32>("out_type"),
+                        QuantizedDepthwiseConv2DOp<quint8, quint8>);
+
+}  // namespace tensorflow
@@ -0,0 +1,153 @@
+/* Copyright 2022 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#define EIGEN_USE_THREADS
+
+#include <cmath>
+
+#include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
+#include "tensorflow/core/framework/bounds_check.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/register_types.h"
+#include "tensorflow/core/framework/tensor.h"
+#include "tensorflow/core/util/work_sharder.h"
+
+namespace tensorflow {
+
+// Fused ragged embedding lookup and pooling: for each ragged row r, pools
+// params[ids[row_splits[r]:row_splits[r+1]]] with the configured combiner in
+// one pass, without materializing the gathered matrix. Replaces the
+// RaggedTensor -> Gather -> SegmentSum/Mean chains that recsys inference
+// otherwise issues per feature.
+template <typename T, typename Tids, typename Tsplits>
+class RaggedEmbeddingPoolOp : public OpKernel {
+ public:
+  explicit RaggedEmbeddingPoolOp(OpKernelConstruction* ctx) : OpKernel(ctx) {
+    OP_REQUIRES_OK(ctx, ctx->GetAttr("combiner", &combiner_));
+  }
+
+  void Compute(OpKernelContext* ctx) override {
+    const Tensor& params = ctx->input(0);
+    const Tensor& ids = ctx->input(1);
+    const Tensor& row_splits = ctx->input(2);
+
+    OP_REQUIRES(ctx, params.dims() == 2,
+                errors::InvalidArgument("params must be rank 2, got shape ",
+                                        params.shape().DebugString()));
+    OP_REQUIRES(ctx, ids.dims() == 1,
+                errors::InvalidArgument("ids must be rank 1, got shape ",
+                                        ids.shape().DebugString()));
+    OP_REQUIRES(ctx, row_splits.dims() == 1 && row_splits.NumElements() >= 1,
+                errors::InvalidArgument(
+                    "row_splits must be rank 1 with at least one element"));
+
+    const int64_t vocab_size = params.dim_size(0);
+    const int64_t dim = params.dim_size(1);
+    const int64_t num_ids = ids.NumElements();
+    const int64_t num_rows = row_splits.NumElements() - 1;
+
+    const T* params_data = params.flat<T>().data();
+    const Tids* ids_data = ids.flat<Tids>().data();
+    const Tsplits* splits_data = row_splits.flat<Tsplits>().data();
+
+    OP_REQUIRES(ctx, splits_data[0] == 0,
+                errors::InvalidArgument("row_splits must start with 0"));
+    OP_REQUIRES(
+        ctx, static_cast<int64_t>(splits_data[num_rows]) == num_ids,
+        errors::InvalidArgument("row_splits must end with the number of ids (",
+                                num_ids, "), got ", splits_data[num_rows]));
+
+    Tensor* output = nullptr;
+    OP_REQUIRES_OK(ctx,
+                   ctx->allocate_output(0, TensorShape({num_rows, dim}),
+                                        &output));
+    if (num_rows == 0) return;
+    T* output_data = output->flat<T>().data();
+
+    // Validate monotonicity and id bounds up front so that the sharded pool
+    // loop below runs unchecked.
+    for (int64_t r = 0; r < num_rows; ++r) {
+      OP_REQUIRES(ctx, splits_data[r] <= splits_data[r + 1],
+                  errors::InvalidArgument(
+                      "row_splits must be non-decreasing; row_splits[", r,
+                      "] = ", splits_data[r], " > ", splits_data[r + 1]));
+    }
+    for (int64_t i = 0; i < num_ids; ++i) {
+      OP_REQUIRES(ctx, FastBoundsCheck(ids_data[i], vocab_size),
+                  errors::InvalidArgument("ids[", i, "] = ", ids_data[i],
+                                          " is out of range [0, ", vocab_size,
+                                          ")"));
+    }
+
+    const bool mean = combiner_ == "mean";
+    const bool sqrtn = combiner_ == "sqrtn";
+    auto pool_rows = [&](int64_t start_row, int64_t limit_row) {
+      typedef Eigen::Array<T, Eigen::Dynamic, 1> ArrayT;
+      for (int64_t r = start_row; r < limit_row; ++r) {
+        const int64_t begin = splits_data[r];
+        const int64_t end = splits_data[r + 1];
+        Eigen::Map<ArrayT> out(output_data + r * dim, dim);
+        if (begin == end) {
+          out.setZero();
+          continue;
+        }
+        out = Eigen::Map<const ArrayT>(
+            params_data + static_cast<int64_t>(ids_data[begin]) * dim, dim);
+        for (int64_t i = begin + 1; i < end; ++i) {
+          out += Eigen::Map<const ArrayT>(
+              params_data + static_cast<int64_t>(ids_data[i]) * dim, dim);
+        }
+        const int64_t count = end - begin;
+        if (mean) {
+          out *= static_cast<T>(1) / static_cast<T>(count);
+        } else if (sqrtn) {
+          out *= static_cast<T>(1) /
+                 static_cast<T>(std::sqrt(static_cast<double>(count)));
+        }
+      }
+    };
+
+    auto worker_threads = *(ctx->device()->tensorflow_cpu_worker_threads());
+    const int64_t average_ids_per_row = (num_ids + num_rows - 1) / num_rows;
+    const int64_t cost_per_row = (average_ids_per_row + 1) * dim * 2;
+    Shard(worker_threads.num_threads, worker_threads.workers, num_rows,
+          cost_per_row, pool_rows);
+  }
+
+ private:
+  string combiner_;
+};
+
+#define REGISTER(T, Tids, Tsplits)                                      \
+  REGISTER_KERNEL_BUILDER(Name("RaggedEmbeddingPool")                   \
+                              .Device(DEVICE_CPU)                       \
+                              .TypeConstraint<T>("T")                   \
+                              .TypeConstraint<Tids>("Tids")             \
+                              .TypeConstraint<Tsplits>("Tsplits"),      \
+                          RaggedEmbeddingPoolOp<T, Tids, Tsplits>)
+
+#define REGISTER_FOR_TYPE(T) \
+  REGISTER(T, int32, int32); \
+  REGISTER(T, int32, int64_t); \
+  REGISTER(T, int64_t, int32); \
+  REGISTER(T, int64_t, int64_t)
+
+REGISTER_FOR_TYPE(float);
+REGISTER_FOR_TYPE(double);
+
+#undef REGISTER_FOR_TYPE
+#undef REGISTER
+
+}  // namespace tensorflow
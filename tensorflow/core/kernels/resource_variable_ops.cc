@@ -136,7 +136,7 @@ Status CopyVariable(int output_idx, OpKernelContext* ctx, const Tensor* t) {
 void ReadVariableOp::Compute(OpKernelContext* ctx) {
   core::RefCountPtr<Var> variable;
   const ResourceHandle& handle = HandleFromInput(ctx, 0);
-  const auto status = LookupResource(ctx, handle, &variable);
+  const auto status = handle_cache_.Lookup(ctx, handle, &variable);
   OP_REQUIRES(ctx, status.ok(),
               errors::FailedPrecondition(
                   "Could not find variable ", handle.name(), ". ",
@@ -46,6 +46,9 @@ class ReadVariableOp : public OpKernel {
 
  private:
   DataType dtype_;
+  // Steady-state reads of the same (non-ref-counting) handle resolve
+  // through this cache instead of the ResourceMgr table.
+  ResourceHandleCache<Var> handle_cache_;
 };
 
 class ReadVariablesOp : public OpKernel {
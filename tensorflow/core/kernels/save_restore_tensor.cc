@@ -15,6 +15,12 @@ limitations under the License.
 
 #include "tensorflow/core/kernels/save_restore_tensor.h"
 
+#include <cstdlib>
+#include <cstring>
+
+#include "absl/container/flat_hash_map.h"
+#include "tensorflow/core/platform/fingerprint.h"
+
 #include <memory>
 #include <numeric>
 #include <unordered_map>
@@ -293,6 +299,58 @@ struct RestoreOp {
     status = run(&reader);
   }
 
+  // Process-wide content-addressed store of restored tensors, enabled by
+  // TF_DEDUP_RESTORED_TENSORS=1. Blue/green model swaps briefly hold two
+  // versions whose weights are largely identical; deduplicating at restore
+  // time makes both versions' variables share one buffer per distinct
+  // value. This is sound for resource variables: their in-place update path
+  // copies when the buffer is shared (PrepareToUpdateVariable), giving
+  // copy-on-write semantics, and plain assignment replaces the tensor.
+  // Legacy ref variables mutate buffers directly and must not use this.
+  class RestoredTensorStore {
+   public:
+    static RestoredTensorStore* Global() {
+      static RestoredTensorStore* store = new RestoredTensorStore;
+      return store;
+    }
+
+    // If an identical tensor is already in the store, sets *out and returns
+    // true. Otherwise records `tensor` and returns false.
+    bool FindOrInsert(const Tensor& tensor, Tensor* out) {
+      const StringPiece data = tensor.tensor_data();
+      const Fprint128 fingerprint = Fingerprint128(data);
+      mutex_lock l(mu_);
+      auto it = tensors_.find(fingerprint);
+      if (it != tensors_.end() && it->second.dtype() == tensor.dtype() &&
+          it->second.shape() == tensor.shape()) {
+        *out = it->second;
+        return true;
+      }
+      // Bound how much the store can pin: once the map grows past the cap
+      // (many generations of unique weights), drop it wholesale; the next
+      // restore repopulates it with the current generation.
+      constexpr size_t kMaxEntries = 16384;
+      if (tensors_.size() >= kMaxEntries) {
+        tensors_.clear();
+      }
+      tensors_.emplace(fingerprint, tensor);
+      return false;
+    }
+
+   private:
+    mutex mu_;
+    absl::flat_hash_map<Fprint128, Tensor, Fprint128Hasher> tensors_
+        TF_GUARDED_BY(mu_);
+  };
+
+  static bool DedupRestoredTensorsEnabled() {
+    static const bool enabled = [] {
+      const char* value = std::getenv("TF_DEDUP_RESTORED_TENSORS");
+      return value != nullptr && strcmp(value, "1") == 0;
+    }();
+    return enabled;
+  }
+
   Status run(BundleReader* reader) {
     TensorShape restored_full_shape;
     TF_RETURN_IF_ERROR(
@@ -306,6 +364,19 @@ struct RestoreOp {
       TF_RETURN_IF_ERROR(
           context->allocate_output(idx, restored_full_shape, &restored_tensor));
       TF_RETURN_IF_ERROR(reader->Lookup(tensor_name, restored_tensor));
+      // Weight-sized tensors may be deduplicated against previously restored
+      // identical content (e.g. the previous model version).
+      constexpr int64_t kMinDedupBytes = 4096;
+      if (DedupRestoredTensorsEnabled() &&
+          DataTypeCanUseMemcpy(restored_tensor->dtype()) &&
+          static_cast<int64_t>(restored_tensor->TotalBytes()) >=
+              kMinDedupBytes) {
+        Tensor shared;
+        if (RestoredTensorStore::Global()->FindOrInsert(*restored_tensor,
+                                                        &shared)) {
+          context->set_output(idx, shared);
+        }
+      }
     } else {
       // Lookup the slice.
       TensorShape parsed_full_shape;
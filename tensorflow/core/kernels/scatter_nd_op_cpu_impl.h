@@ -20,7 +20,9 @@ limitations under the License.
 
 #define EIGEN_USE_THREADS
 
+#include <algorithm>
 #include <atomic>
+#include <vector>
 
 #include "third_party/eigen3/unsupported/Eigen/CXX11/Tensor"
 
@@ -128,6 +130,9 @@ struct ScatterNdFunctor<CPUDevice, T, Index, OP, IXDIM> {
       }
     }
 
+    // Precompute (and bounds-check) the flattened destination row of every
+    // update once, so the apply phase below can be parallelized.
+    std::vector<Index> locs(batch_size);
     for (Eigen::DenseIndex loc = 0; loc < batch_size; ++loc) {
       Index i = 0;
       bool out_of_bounds = false;
@@ -137,9 +142,15 @@ struct ScatterNdFunctor<CPUDevice, T, Index, OP, IXDIM> {
         i += ix_d * batch_strides[dim];
       }
       if (TF_PREDICT_FALSE(out_of_bounds)) {
-        error_loc = loc;
-        break;
-      } else {
+        return loc;
+      }
+      locs[loc] = i;
+    }
+
+    auto apply_row_range = [&](Index first_row, Index end_row) {
+      for (Eigen::DenseIndex loc = 0; loc < batch_size; ++loc) {
+        const Index i = locs[loc];
+        if (i < first_row || i >= end_row) continue;
         auto input_chip = Toutput.template chip<0>(i);
         auto output_chip = input_chip;
         auto update_chip = Tupdates.template chip<0>(loc);
@@ -148,7 +159,38 @@ struct ScatterNdFunctor<CPUDevice, T, Index, OP, IXDIM> {
             decltype(output_chip), OP>::Execute(d, input_chip, update_chip,
                                                 output_chip);
       }
+    };
+
+    // Deterministic parallel apply: each shard owns a disjoint, contiguous
+    // range of output rows and applies the updates that target its rows in
+    // their original order, so the result is bitwise identical to the serial
+    // loop regardless of thread count. Every shard scans the whole `locs`
+    // array, so sharding is only engaged when the update volume dwarfs the
+    // scan cost.
+    const Eigen::DenseIndex num_rows = Toutput.dimension(0);
+    const Eigen::DenseIndex total_work = batch_size * slice_size;
+    constexpr Eigen::DenseIndex kMinWorkForParallelApply = 1 << 16;
+    const int max_shards =
+        std::min<Eigen::DenseIndex>(d.numThreads(), num_rows);
+    if (max_shards <= 1 || total_work < kMinWorkForParallelApply) {
+      apply_row_range(0, static_cast<Index>(num_rows));
+      return error_loc;
     }
+    const int num_shards = std::min<int>(max_shards, 16);
+    d.parallelFor(
+        num_shards,
+        Eigen::TensorOpCost(total_work * sizeof(T) / num_shards,
+                            total_work * sizeof(T) / num_shards,
+                            total_work / num_shards),
+        [&](Eigen::Index start, Eigen::Index end) {
+          for (Eigen::Index shard = start; shard < end; ++shard) {
+            const Index first_row =
+                static_cast<Index>(num_rows * shard / num_shards);
+            const Index end_row =
+                static_cast<Index>(num_rows * (shard + 1) / num_shards);
+            apply_row_range(first_row, end_row);
+          }
+        });
 
     return error_loc;
   }
@@ -18,7 +18,9 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_KERNELS_SEGMENT_REDUCTION_OPS_IMPL_H_
 #define TENSORFLOW_CORE_KERNELS_SEGMENT_REDUCTION_OPS_IMPL_H_
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 #include "tensorflow/core/framework/op_requires.h"
 #include "tensorflow/core/platform/types.h"
@@ -404,26 +406,54 @@ struct UnsortedSegmentFunctor<CPUDevice, T, Index, InitialValueF, ReductionF> {
     //   | b1 |  | 1 |
     //   | a1 |  | 0 |
     //
-    // TODO(intel-tf): Balance workload in `row_counter` to make parallelism
-    //                 more efficient.
-    auto reductionWorker = [&](int64_t begin, int64_t end) -> void {
-      for (int64_t i = 0; i < N; i++) {
-        Index j = internal::SubtleMustCopy(segment_ids(i));
-        // If `j` is in work scope of this worker, do the reduction.
-        if (j >= begin && j < end) {
-          reduction(data.template chip<0>(i), output.template chip<0>(j));
+    // Each worker owns a contiguous range of output segments, so the
+    // reduction stays deterministic. The ranges are chosen using
+    // `row_counter` so that every shard reduces roughly the same number of
+    // input rows; uniform per-segment sharding serializes badly when a few
+    // hot segments hold most of the rows (common for graph workloads).
+    const int64_t max_shards = std::max<int64_t>(
+        1, std::min<int64_t>(cpu_device.numThreads(), num_segments));
+    std::vector<int64_t> shard_bounds;
+    shard_bounds.reserve(max_shards + 1);
+    shard_bounds.push_back(0);
+    {
+      const int64_t rows_per_shard =
+          (num_real_segment + max_shards - 1) / max_shards;
+      int64_t rows_in_shard = 0;
+      for (int64_t j = 0; j < num_segments; ++j) {
+        rows_in_shard += row_counter[j];
+        if (rows_in_shard >= rows_per_shard &&
+            static_cast<int64_t>(shard_bounds.size()) < max_shards) {
+          shard_bounds.push_back(j + 1);
+          rows_in_shard = 0;
+        }
+      }
+      shard_bounds.push_back(num_segments);
+    }
+    const int64_t num_shards = shard_bounds.size() - 1;
+
+    auto reductionWorker = [&](int64_t first_shard, int64_t limit_shard) {
+      for (int64_t shard = first_shard; shard < limit_shard; ++shard) {
+        const Index begin = static_cast<Index>(shard_bounds[shard]);
+        const Index end = static_cast<Index>(shard_bounds[shard + 1]);
+        for (int64_t i = 0; i < N; i++) {
+          Index j = internal::SubtleMustCopy(segment_ids(i));
+          // If `j` is in work scope of this worker, do the reduction.
+          if (j >= begin && j < end) {
+            reduction(data.template chip<0>(i), output.template chip<0>(j));
+          }
         }
       }
     };
 
     // Reduction functors includes Sum, Max, Min, etc. Simply consider it
     // will cost 5 cycles per operation.
-    const int64_t kAverTaskSize = num_real_segment / num_segments;
-    const int64_t compute_cycles = 5 * inner_dim * kAverTaskSize;
-    const int64_t input_bytes = sizeof(T) * inner_dim * kAverTaskSize;
-    const int64_t output_bytes = sizeof(T) * inner_dim * kAverTaskSize;
+    const int64_t rows_per_shard = num_real_segment / num_shards;
+    const int64_t compute_cycles = 5 * inner_dim * rows_per_shard;
+    const int64_t input_bytes = sizeof(T) * inner_dim * rows_per_shard;
+    const int64_t output_bytes = sizeof(T) * inner_dim * rows_per_shard;
     const Eigen::TensorOpCost cost(input_bytes, output_bytes, compute_cycles);
-    cpu_device.parallelFor(num_segments, cost, reductionWorker);
+    cpu_device.parallelFor(num_shards, cost, reductionWorker);
   }
 };
 
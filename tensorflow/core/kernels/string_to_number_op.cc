@@ -30,6 +30,27 @@ namespace tensorflow {
 static constexpr char kErrorMessage[] =
     "StringToNumberOp could not correctly convert string: ";
 
+namespace {
+
+// Fast-path conversion for floating point outputs; other types (and inputs
+// the fast parser rejects) fall through to SafeStringToNumeric.
+template <typename T>
+bool FastStringToNumeric(const tstring& s, T* value) {
+  return false;
+}
+
+template <>
+bool FastStringToNumeric<float>(const tstring& s, float* value) {
+  return strings::fast_strtof_plain(StringPiece(s.data(), s.size()), value);
+}
+
+template <>
+bool FastStringToNumeric<double>(const tstring& s, double* value) {
+  return strings::fast_strtod_plain(StringPiece(s.data(), s.size()), value);
+}
+
+}  // namespace
+
 template <typename OutputType>
 class StringToNumberOp : public OpKernel {
  public:
@@ -51,8 +72,9 @@ class StringToNumberOp : public OpKernel {
     for (int i = 0; i < input_flat.size(); ++i) {
       OP_REQUIRES(
           context,
-          strings::SafeStringToNumeric<OutputType>(input_flat(i),
-                                                   &output_flat(i)),
+          FastStringToNumeric<OutputType>(input_flat(i), &output_flat(i)) ||
+              strings::SafeStringToNumeric<OutputType>(input_flat(i),
+                                                       &output_flat(i)),
           errors::InvalidArgument(kErrorMessage, input_flat(i).c_str()));
     }
   }
@@ -141,6 +141,77 @@ struct TopKFunctor<CPUDevice, T> {
       return Status::OK();
     }
 
+    // For a few tall rows (retrieval-style: k in the thousands over millions
+    // of candidates), sharding by row leaves most cores idle. Shard within
+    // the row instead: each worker selects a local top-k from a column chunk
+    // under the same (value desc, index asc) total order. Any element of the
+    // row's true top-k has fewer than k predecessors globally, hence fewer
+    // than k within its own chunk, so the union of the local winners
+    // provably contains the exact, deterministic answer, which a final
+    // selection over num_shards * k candidates extracts.
+    {
+      auto worker_threads = *(context->device()->tensorflow_cpu_worker_threads());
+      constexpr int64_t kMinChunkCols = 1 << 16;
+      const int64_t num_shards =
+          std::min<int64_t>(worker_threads.num_threads,
+                            num_cols / std::max<int64_t>(k, kMinChunkCols));
+      if (k > 1 && k < num_cols && num_shards >= 2 &&
+          num_rows < worker_threads.num_threads) {
+        for (int64_t b = 0; b < num_rows; ++b) {
+          const T* input_data = &input(b, 0);
+          const auto stable_comp = [input_data](const int32_t a,
+                                                const int32_t b) {
+            if (input_data[b] < input_data[a]) {
+              return true;
+            } else if (input_data[b] > input_data[a]) {
+              return false;
+            } else {
+              return a < b;
+            }
+          };
+          std::vector<int32> candidates(num_shards * k);
+          auto select_chunk = [&](int64_t start_shard, int64_t limit_shard) {
+            for (int64_t shard = start_shard; shard < limit_shard; ++shard) {
+              const int64_t c0 = num_cols * shard / num_shards;
+              const int64_t c1 = num_cols * (shard + 1) / num_shards;
+              gtl::TopN<int32, decltype(stable_comp)> filter(k, stable_comp);
+              filter.reserve(c1 - c0);
+              for (int64_t c = c0; c < c1; ++c) {
+                filter.push(static_cast<int32>(c));
+              }
+              int64_t i = shard * k;
+              for (auto it = filter.unsorted_begin();
+                   it != filter.unsorted_end(); ++it, ++i) {
+                candidates[i] = *it;
+              }
+            }
+          };
+          const double chunk_cost =
+              4 * (3 * Eigen::TensorOpCost::AddCost<int32>() +
+                   Eigen::TensorOpCost::AddCost<T>()) *
+              static_cast<double>(num_cols / num_shards) *
+              Eigen::numext::log2(static_cast<float>(k + 1));
+          Shard(worker_threads.num_threads, worker_threads.workers, num_shards,
+                static_cast<int64_t>(chunk_cost), select_chunk);
+
+          // Final selection over the candidate pool.
+          if (sorted) {
+            std::partial_sort(candidates.begin(), candidates.begin() + k,
+                              candidates.end(), stable_comp);
+          } else {
+            std::nth_element(candidates.begin(), candidates.begin() + k - 1,
+                             candidates.end(), stable_comp);
+          }
+          std::copy(candidates.begin(), candidates.begin() + k,
+                    &indices(b, 0));
+          std::transform(
+              &indices(b, 0), &indices(b, k), &values(b, 0),
+              [b, &input](const int32_t loc) { return input(b, loc); });
+        }
+        return Status::OK();
+      }
+    }
+
     auto SortIndices = [&](int64_t start_batch, int64_t limit_batch) {
       for (int32_t b = start_batch; b < limit_batch; ++b) {
         const T* input_data = &input(b, 0);
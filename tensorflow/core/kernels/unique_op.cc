@@ -13,9 +13,12 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
 #include <functional>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "absl/container/flat_hash_map.h"
 #include "tensorflow/core/framework/bounds_check.h"
@@ -26,6 +29,7 @@ limitations under the License.
 #include "tensorflow/core/lib/core/status.h"
 #include "tensorflow/core/lib/hash/hash.h"
 #include "tensorflow/core/platform/bfloat16.h"
+#include "tensorflow/core/util/work_sharder.h"
 
 namespace tensorflow {
 namespace {
@@ -68,6 +72,130 @@ struct UniqueOpHashMap<bfloat16, TIndex> {
   using map_type = std::unordered_map<bfloat16, TIndex>;
 };
 
+// Inputs smaller than this run the sequential loop: the parallel path below
+// makes extra passes over the input, which only pay for themselves on large
+// batches (e.g. de-duplicating embedding ids).
+constexpr int64_t kMinElementsForParallelUnique = 1 << 19;
+
+// Hash-partitioned parallel implementation of the 1-D (scalar element) unique
+// path. Each partition owns the keys whose hash maps onto it and builds its
+// first-occurrence table independently; the final unique ids are assigned by
+// ranking first-occurrence indices globally, so the output is identical to
+// what the sequential loop produces. Only element types whose map supports
+// re-finding every inserted key are eligible: the floating-point types use
+// `std::unordered_map` to admit NaN keys, and a NaN key can never be looked
+// up again, so they stay on the sequential path.
+//
+// Sets `*handled` to false (without touching any output) when the input is
+// ineligible or too small to benefit.
+template <typename T, typename TIndex>
+Status ParallelScalarUnique(OpKernelContext* context, const Tensor& input,
+                            int64_t axis,
+                            typename TTypes<TIndex>::Vec idx_vec,
+                            int64_t* uniq_size, bool* handled) {
+  using map_type = typename UniqueOpHashMap<T, TIndex>::map_type;
+  using key_type = typename map_type::key_type;
+  *handled = false;
+  if (!std::is_integral<T>::value && !std::is_same<T, tstring>::value) {
+    return Status::OK();
+  }
+  auto Tin = input.flat<T>();
+  const int64_t N = static_cast<int64_t>(Tin.size());
+  auto* worker_threads = context->device()->tensorflow_cpu_worker_threads();
+  const int64_t num_partitions = std::min<int64_t>(
+      {static_cast<int64_t>(worker_threads->num_threads), int64_t{64}, N});
+  if (N < kMinElementsForParallelUnique || num_partitions < 2) {
+    return Status::OK();
+  }
+  *handled = true;
+
+  // Rough per-element cost estimate (in cycles) for the sharder.
+  constexpr int64_t kCostPerUnit = 20;
+  typename map_type::hasher hasher;
+
+  // Pass 1: hash every element once, in parallel, recording its partition.
+  std::vector<uint8> partition_of(N);
+  Shard(worker_threads->num_threads, worker_threads->workers, N, kCostPerUnit,
+        [&](int64_t start, int64_t limit) {
+          for (int64_t i = start; i < limit; ++i) {
+            partition_of[i] =
+                static_cast<uint8>(hasher(key_type(Tin(i))) % num_partitions);
+          }
+        });
+
+  // Pass 2: each partition builds a first-occurrence table over the elements
+  // it owns. The scan over `partition_of` is a byte compare; hashing happens
+  // only for the partition's own elements, and the ascending `i` makes
+  // `emplace` keep the first occurrence.
+  std::vector<map_type> partition_maps(num_partitions);
+  Shard(worker_threads->num_threads, worker_threads->workers, num_partitions,
+        N * kCostPerUnit / num_partitions, [&](int64_t first, int64_t limit) {
+          for (int64_t p = first; p < limit; ++p) {
+            map_type& uniq = partition_maps[p];
+            uniq.reserve(2 * N / num_partitions);
+            for (int64_t i = 0; i < N; ++i) {
+              if (partition_of[i] == p) {
+                uniq.emplace(Tin(i), static_cast<TIndex>(i));
+              }
+            }
+          }
+        });
+
+  // Rank the first-occurrence indices globally and rewrite each table's
+  // values from first-occurrence index to final unique id. This preserves
+  // the op's ordering contract exactly.
+  std::vector<TIndex> first_indices;
+  size_t num_uniq = 0;
+  for (const map_type& uniq : partition_maps) num_uniq += uniq.size();
+  first_indices.reserve(num_uniq);
+  for (const map_type& uniq : partition_maps) {
+    for (const auto& it : uniq) first_indices.push_back(it.second);
+  }
+  std::sort(first_indices.begin(), first_indices.end());
+  absl::flat_hash_map<TIndex, TIndex> rank_of;
+  rank_of.reserve(num_uniq);
+  for (size_t r = 0; r < first_indices.size(); ++r) {
+    rank_of.emplace(first_indices[r], static_cast<TIndex>(r));
+  }
+  Shard(worker_threads->num_threads, worker_threads->workers, num_partitions,
+        num_uniq * kCostPerUnit / num_partitions,
+        [&](int64_t first, int64_t limit) {
+          for (int64_t p = first; p < limit; ++p) {
+            for (auto& it : partition_maps[p]) {
+              it.second = rank_of.find(it.second)->second;
+            }
+          }
+        });
+
+  // Pass 3: the tables are now read-only, so `idx` fills with concurrent
+  // lookups.
+  Shard(worker_threads->num_threads, worker_threads->workers, N, kCostPerUnit,
+        [&](int64_t start, int64_t limit) {
+          for (int64_t i = start; i < limit; ++i) {
+            idx_vec(i) =
+                partition_maps[partition_of[i]].find(key_type(Tin(i)))->second;
+          }
+        });
+
+  *uniq_size = static_cast<int64_t>(num_uniq);
+  TensorShape output_shape(input.shape());
+  output_shape.set_dim(axis, *uniq_size);
+  Tensor* output = nullptr;
+  TF_RETURN_IF_ERROR(context->allocate_output(0, output_shape, &output));
+  auto Tout = output->flat<T>();
+  // Every entry holds a distinct final id, so the writes are disjoint.
+  Shard(worker_threads->num_threads, worker_threads->workers, num_partitions,
+        num_uniq * kCostPerUnit / num_partitions,
+        [&](int64_t first, int64_t limit) {
+          for (int64_t p = first; p < limit; ++p) {
+            for (const auto& it : partition_maps[p]) {
+              Tout(it.second) = it.first;
+            }
+          }
+        });
+  return Status::OK();
+}
+
 // `UniqueOp` computes the unique elements in the input tensor.
 //
 // * `T` is the element type.
@@ -147,29 +275,35 @@ class UniqueOp : public OpKernel {
       // Specialized and faster implementation when unique is run over single
       // elements. Here we put T directly into the map rather than ints pointing
       // to them as in the general case.
-      auto Tin = input.flat<T>();
-      const int64_t N = static_cast<int64_t>(Tin.size());
+      bool handled = false;
+      OP_REQUIRES_OK(context, ParallelScalarUnique<T, TIndex>(
+                                  context, input, axis, idx_vec, &uniq_size,
+                                  &handled));
+      if (!handled) {
+        auto Tin = input.flat<T>();
+        const int64_t N = static_cast<int64_t>(Tin.size());
 
-      typename UniqueOpHashMap<T, TIndex>::map_type uniq;
-      uniq.reserve(2 * N);
-      for (Eigen::Index i = 0, j = 0; i < N; ++i) {
-        auto it = uniq.emplace(Tin(i), j);
-        idx_vec(i) = it.first->second;
-        if (it.second) {
-          ++j;
+        typename UniqueOpHashMap<T, TIndex>::map_type uniq;
+        uniq.reserve(2 * N);
+        for (Eigen::Index i = 0, j = 0; i < N; ++i) {
+          auto it = uniq.emplace(Tin(i), j);
+          idx_vec(i) = it.first->second;
+          if (it.second) {
+            ++j;
+          }
         }
-      }
 
-      uniq_size = static_cast<int64_t>(uniq.size());
-      TensorShape output_shape(input.shape());
-      output_shape.set_dim(axis, uniq_size);
-      Tensor* output = nullptr;
-      OP_REQUIRES_OK(context,
-                     context->allocate_output(0, output_shape, &output));
-      auto Tout = output->flat<T>();
+        uniq_size = static_cast<int64_t>(uniq.size());
+        TensorShape output_shape(input.shape());
+        output_shape.set_dim(axis, uniq_size);
+        Tensor* output = nullptr;
+        OP_REQUIRES_OK(context,
+                       context->allocate_output(0, output_shape, &output));
+        auto Tout = output->flat<T>();
 
-      for (const auto& it : uniq) {
-        Tout(it.second) = it.first;
+        for (const auto& it : uniq) {
+          Tout(it.second) = it.first;
+        }
       }
     } else {
       // General implementation when unique is run over multiple elements.
@@ -18,33 +18,80 @@ limitations under the License.
 
 // SSE4.2 accelerated CRC32c.
 
-// See if the SSE4.2 crc32c instruction is available.
+// See if the SSE4.2 crc32c instruction is available. Unlike the original
+// gate, this does not require the whole build to target SSE4.2
+// (-msse4.2): on x86-64 compilers that support per-function target
+// attributes, the accelerated function itself is compiled for SSE4.2 and
+// selected at runtime via __builtin_cpu_supports, so generic builds still
+// get the hardware CRC on capable machines.
 #undef USE_SSE_CRC32C
-#ifdef __SSE4_2__
+#undef USE_TARGET_ATTRIBUTE_SSE_CRC32C
 #if defined(__x86_64__) && defined(__GNUC__) && \
     (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8))
 #define USE_SSE_CRC32C 1
+#ifndef __SSE4_2__
+#define USE_TARGET_ATTRIBUTE_SSE_CRC32C 1
+#endif
 #elif defined(__x86_64__) && defined(__clang__)
 #if __has_builtin(__builtin_cpu_supports)
 #define USE_SSE_CRC32C 1
+#ifndef __SSE4_2__
+#define USE_TARGET_ATTRIBUTE_SSE_CRC32C 1
+#endif
 #endif
 #endif
-#endif /* __SSE4_2__ */
 
 // This version of Apple clang has a bug:
 // https://llvm.org/bugs/show_bug.cgi?id=25510
 #if defined(__APPLE__) && (__clang_major__ <= 8)
 #undef USE_SSE_CRC32C
+#undef USE_TARGET_ATTRIBUTE_SSE_CRC32C
+#endif
+
+// ARMv8 CRC32C instructions, available when the build targets them.
+#undef USE_ARM_CRC32C
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#define USE_ARM_CRC32C 1
+#include <arm_acle.h>
 #endif
 
 #ifdef USE_SSE_CRC32C
 #include <nmmintrin.h>
+#ifdef USE_TARGET_ATTRIBUTE_SSE_CRC32C
+#define CRC32C_TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define CRC32C_TARGET_SSE42
+#endif
 #endif
 
 namespace tensorflow {
 namespace crc32c {
 
-#ifndef USE_SSE_CRC32C
+#if defined(USE_ARM_CRC32C)
+
+bool CanAccelerate() { return true; }
+
+uint32_t AcceleratedExtend(uint32_t crc, const char *buf, size_t size) {
+  const uint8_t *p = reinterpret_cast<const uint8_t *>(buf);
+  const uint8_t *e = p + size;
+  uint32_t l = crc ^ 0xffffffffu;
+
+  while ((e - p) >= 8 && (reinterpret_cast<uintptr_t>(p) & 7) != 0) {
+    l = __crc32cb(l, *p);
+    p++;
+  }
+  while ((e - p) >= 8) {
+    l = __crc32cd(l, *reinterpret_cast<const uint64_t *>(p));
+    p += 8;
+  }
+  while (p < e) {
+    l = __crc32cb(l, *p);
+    p++;
+  }
+  return l ^ 0xffffffffu;
+}
+
+#elif !defined(USE_SSE_CRC32C)
 
 bool CanAccelerate() { return false; }
 uint32_t AcceleratedExtend(uint32_t crc, const char *buf, size_t size) {
@@ -54,9 +101,10 @@ uint32_t AcceleratedExtend(uint32_t crc, const char *buf, size_t size) {
 
 #else
 
-// SSE4.2 optimized crc32c computation.
+// SSE4.2 optimized crc32c computation, runtime-selected.
 bool CanAccelerate() { return __builtin_cpu_supports("sse4.2"); }
 
+CRC32C_TARGET_SSE42
 uint32_t AcceleratedExtend(uint32_t crc, const char *buf, size_t size) {
   const uint8_t *p = reinterpret_cast<const uint8_t *>(buf);
   const uint8_t *e = p + size;
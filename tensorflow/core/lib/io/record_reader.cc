@@ -114,6 +114,60 @@ Status RecordReader::ReadChecksummed(uint64 offset, size_t n, tstring* result) {
   return Status::OK();
 }
 
+Status MemoryMappedRecordReader::Create(
+    Env* env, const string& filename, const Options& options,
+    std::unique_ptr<MemoryMappedRecordReader>* out) {
+  std::unique_ptr<ReadOnlyMemoryRegion> region;
+  TF_RETURN_IF_ERROR(env->NewReadOnlyMemoryRegionFromFile(filename, &region));
+  out->reset(new MemoryMappedRecordReader(std::move(region), options));
+  return Status::OK();
+}
+
+MemoryMappedRecordReader::MemoryMappedRecordReader(
+    std::unique_ptr<ReadOnlyMemoryRegion> region, const Options& options)
+    : region_(std::move(region)), options_(options) {}
+
+Status MemoryMappedRecordReader::ReadRecord(uint64* offset,
+                                            StringPiece* record) {
+  const char* const base = static_cast<const char*>(region_->data());
+  const uint64 file_size = region_->length();
+
+  if (*offset >= file_size) {
+    return errors::OutOfRange("eof");
+  }
+  if (file_size - *offset < RecordReader::kHeaderSize) {
+    return errors::DataLoss("truncated record at ", *offset);
+  }
+
+  // Length and its CRC are always validated: a corrupt length would
+  // desynchronize every subsequent read.
+  const char* header = base + *offset;
+  const uint64 length = core::DecodeFixed64(header);
+  const uint32 masked_length_crc = core::DecodeFixed32(header + sizeof(uint64));
+  if (crc32c::Unmask(masked_length_crc) !=
+      crc32c::Value(header, sizeof(uint64))) {
+    return errors::DataLoss("corrupted record at ", *offset);
+  }
+  if (length > file_size - *offset - RecordReader::kHeaderSize ||
+      file_size - *offset - RecordReader::kHeaderSize - length <
+          RecordReader::kFooterSize) {
+    return errors::DataLoss("truncated record at ", *offset);
+  }
+
+  const char* data = header + RecordReader::kHeaderSize;
+  if (options_.verify_checksums) {
+    const uint32 masked_data_crc = core::DecodeFixed32(data + length);
+    if (crc32c::Unmask(masked_data_crc) != crc32c::Value(data, length)) {
+      return errors::DataLoss("corrupted record at ", *offset);
+    }
+  }
+
+  *record = StringPiece(data, length);
+  *offset +=
+      RecordReader::kHeaderSize + length + RecordReader::kFooterSize;
+  return Status::OK();
+}
+
 Status RecordReader::GetMetadata(Metadata* md) {
   if (!md) {
     return errors::InvalidArgument(
@@ -245,5 +299,22 @@ SequentialRecordReader::SequentialRecordReader(
     RandomAccessFile* file, const RecordReaderOptions& options)
     : underlying_(file, options), offset_(0) {}
 
+Status SequentialRecordReader::ReadRecords(int64_t n,
+                                           std::vector<tstring>* records) {
+  for (int64_t i = 0; i < n; ++i) {
+    tstring record;
+    Status s = underlying_.ReadRecord(&offset_, &record);
+    if (!s.ok()) {
+      if (errors::IsOutOfRange(s) && i > 0) {
+        // A partial batch is success; the next call reports end of file.
+        return Status::OK();
+      }
+      return s;
+    }
+    records->push_back(std::move(record));
+  }
+  return Status::OK();
+}
+
 }  // namespace io
 }  // namespace tensorflow
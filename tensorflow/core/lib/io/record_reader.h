@@ -16,6 +16,9 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_LIB_IO_RECORD_READER_H_
 #define TENSORFLOW_CORE_LIB_IO_RECORD_READER_H_
 
+#include <memory>
+#include <vector>
+
 #include "tensorflow/core/lib/core/errors.h"
 #include "tensorflow/core/lib/core/stringpiece.h"
 #include "tensorflow/core/lib/io/inputstream_interface.h"
@@ -30,7 +33,9 @@ limitations under the License.
 
 namespace tensorflow {
 
+class Env;
 class RandomAccessFile;
+class ReadOnlyMemoryRegion;
 
 namespace io {
 
@@ -128,6 +133,44 @@ class RecordReader {
   TF_DISALLOW_COPY_AND_ASSIGN(RecordReader);
 };
 
+// Zero-copy reader for uncompressed TFRecord files backed by a memory
+// mapping. ReadRecord returns a StringPiece aliasing the mapped region, so
+// record payloads are never copied; the views remain valid for the lifetime
+// of the reader. CRC validation uses the (hardware-accelerated where
+// available) crc32c implementation and can be deferred entirely by setting
+// `verify_checksums` to false, e.g. for throwaway scans of trusted local
+// files.
+//
+// Note: this class is not thread safe; external synchronization required.
+class MemoryMappedRecordReader {
+ public:
+  struct Options {
+    // If false, record data CRCs are not validated (length CRCs are always
+    // checked, since a corrupt length desynchronizes the stream).
+    bool verify_checksums = true;
+  };
+
+  // Maps `filename` and returns a reader over it. Fails on filesystems
+  // without memory-mapping support.
+  static Status Create(Env* env, const string& filename,
+                       const Options& options,
+                       std::unique_ptr<MemoryMappedRecordReader>* out);
+
+  MemoryMappedRecordReader(std::unique_ptr<ReadOnlyMemoryRegion> region,
+                           const Options& options);
+
+  // Reads the record at "*offset" and updates *offset to point to the next
+  // record. *record aliases the mapped file. Returns OK on success,
+  // OUT_OF_RANGE at end of file, DATA_LOSS on corruption.
+  Status ReadRecord(uint64* offset, StringPiece* record);
+
+ private:
+  const std::unique_ptr<ReadOnlyMemoryRegion> region_;
+  const Options options_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(MemoryMappedRecordReader);
+};
+
 // High-level interface to read TFRecord files.
 //
 // Note: this class is not thread safe; external synchronization required.
@@ -147,6 +190,15 @@ class SequentialRecordReader {
     return underlying_.ReadRecord(&offset_, record);
   }
 
+  // Reads up to `n` records in one pass, appending them to `*records`.
+  // Bulk reads amortize the per-record dispatch and the input-buffer /
+  // decompression-stream refills for callers that consume records in
+  // batches. Returns OK if at least one record was read (a partial batch
+  // means end of file was reached), OUT_OF_RANGE if the file was already
+  // exhausted, or the underlying error with the records read so far left in
+  // `*records`.
+  Status ReadRecords(int64_t n, std::vector<tstring>* records);
+
   // Skip the next num_to_skip record in the file. Return OK on success,
   // OUT_OF_RANGE for end of file, or something else for an error.
   // "*num_skipped" records the number of records that are actually skipped.
@@ -158,6 +158,36 @@ TEST(RecordReaderWriterTest, TestBasics) {
   }
 }
 
+TEST(RecordReaderWriterTest, TestMemoryMapped) {
+  Env* env = Env::Default();
+  string fname = testing::TmpDir() + "/record_reader_mmap_test";
+
+  {
+    std::unique_ptr<WritableFile> file;
+    TF_CHECK_OK(env->NewWritableFile(fname, &file));
+    io::RecordWriter writer(file.get(), io::RecordWriterOptions());
+    TF_EXPECT_OK(writer.WriteRecord("abc"));
+    TF_EXPECT_OK(writer.WriteRecord("defg"));
+    TF_CHECK_OK(writer.Flush());
+  }
+
+  for (bool verify_checksums : {true, false}) {
+    io::MemoryMappedRecordReader::Options options;
+    options.verify_checksums = verify_checksums;
+    std::unique_ptr<io::MemoryMappedRecordReader> reader;
+    TF_CHECK_OK(
+        io::MemoryMappedRecordReader::Create(env, fname, options, &reader));
+    uint64 offset = 0;
+    StringPiece record;
+    TF_CHECK_OK(reader->ReadRecord(&offset, &record));
+    EXPECT_EQ("abc", record);
+    TF_CHECK_OK(reader->ReadRecord(&offset, &record));
+    EXPECT_EQ("defg", record);
+    Status s = reader->ReadRecord(&offset, &record);
+    EXPECT_TRUE(errors::IsOutOfRange(s)) << s;
+  }
+}
+
 TEST(RecordReaderWriterTest, TestSkipBasic) {
   Env* env = Env::Default();
   string fname = testing::TmpDir() + "/record_reader_writer_skip_basic_test";
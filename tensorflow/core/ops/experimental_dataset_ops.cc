@@ -578,6 +578,24 @@ REGISTER_OP("ExperimentalLMDBDataset")
                                                            "output_types"))
     .SetShapeFn(shape_inference::ScalarShape);
 
+REGISTER_OP("MapFilterBatchDataset")
+    .Input("input_dataset: variant")
+    .Input("other_arguments: Targuments")
+    .Input("batch_size: int64")
+    .Input("drop_remainder: bool")
+    .Input("predicate_other_arguments: Tpredicate_arguments")
+    .Output("handle: variant")
+    .Attr("f: func")
+    .Attr("predicate: func")
+    .Attr("Targuments: list(type) >= 0")
+    .Attr("Tpredicate_arguments: list(type) >= 0")
+    .Attr("output_types: list(type) >= 1")
+    .Attr("output_shapes: list(shape) >= 1")
+    .Attr("metadata: string = ''")
+    .SetTypeConstructor(full_type::VariadicTensorContainer(TFT_DATASET,
+                                                           "output_types"))
+    .SetShapeFn(shape_inference::ScalarShape);
+
 REGISTER_OP("MapAndBatchDataset")
     .Input("input_dataset: variant")
     .Input("other_arguments: Targuments")
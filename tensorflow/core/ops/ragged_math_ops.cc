@@ -38,6 +38,30 @@ REGISTER_OP("RaggedRange")
     .Attr("Tsplits: {int32, int64} = DT_INT64")
     .SetShapeFn(RaggedRangeShapeFn);
 
+REGISTER_OP("RaggedEmbeddingPool")
+    .Input("params: T")
+    .Input("ids: Tids")
+    .Input("row_splits: Tsplits")
+    .Output("output: T")
+    .Attr("T: {float, double}")
+    .Attr("Tids: {int32, int64}")
+    .Attr("Tsplits: {int32, int64}")
+    .Attr("combiner: {'sum', 'mean', 'sqrtn'} = 'mean'")
+    .SetShapeFn([](InferenceContext* c) {
+      ShapeHandle params;
+      ShapeHandle ids;
+      ShapeHandle row_splits;
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &params));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 1, &ids));
+      TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &row_splits));
+      DimensionHandle num_rows = c->UnknownDim();
+      if (c->ValueKnown(c->Dim(row_splits, 0))) {
+        num_rows = c->MakeDim(c->Value(c->Dim(row_splits, 0)) - 1);
+      }
+      c->set_output(0, c->Matrix(num_rows, c->Dim(params, 1)));
+      return Status::OK();
+    });
+
 //==============================================================================
 // Shape Functions
 //==============================================================================
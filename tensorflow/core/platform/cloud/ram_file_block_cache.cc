@@ -165,6 +165,39 @@ Status RamFileBlockCache::MaybeFetch(const Key& key,
       "Control flow should never reach the end of RamFileBlockCache::Fetch.");
 }
 
+void RamFileBlockCache::MaybePrefetchBlock(const Key& key) {
+  {
+    mutex_lock lock(mu_);
+    if (block_map_.find(key) != block_map_.end()) return;
+    if (!prefetches_in_flight_.insert(key).second) return;
+    ++pending_prefetches_;
+  }
+  env_->SchedClosure([this, key]() {
+    std::shared_ptr<Block> block = Lookup(key);
+    if (block) {
+      // Errors are swallowed; the Read that needs this block will refetch
+      // and surface them.
+      MaybeFetch(key, block).IgnoreError();
+      UpdateLRU(key, block).IgnoreError();
+    }
+    mutex_lock lock(mu_);
+    prefetches_in_flight_.erase(key);
+    --pending_prefetches_;
+    prefetch_done_.notify_all();
+  });
+}
+
+void RamFileBlockCache::PrefetchRange(const string& filename, size_t offset,
+                                      size_t len) {
+  if (!IsCacheEnabled() || len == 0) return;
+  const size_t start = block_size_ * (offset / block_size_);
+  size_t finish = block_size_ * ((offset + len) / block_size_);
+  if (finish < offset + len) finish += block_size_;
+  for (size_t pos = start; pos < finish; pos += block_size_) {
+    MaybePrefetchBlock(std::make_pair(filename, pos));
+  }
+}
+
 Status RamFileBlockCache::Read(const string& filename, size_t offset, size_t n,
                                char* buffer, size_t* bytes_transferred) {
   *bytes_transferred = 0;
@@ -224,6 +257,20 @@ Status RamFileBlockCache::Read(const string& filename, size_t offset, size_t n,
     }
   }
   *bytes_transferred = total_bytes_transferred;
+  // Sequential pattern detection: a read that starts where the previous one
+  // ended triggers readahead of the following blocks, overlapping the next
+  // cold fetches with the caller's processing of this range.
+  bool sequential = false;
+  {
+    mutex_lock lock(mu_);
+    auto it = last_read_end_.find(filename);
+    sequential = (it != last_read_end_.end() && it->second == offset);
+    last_read_end_[filename] = offset + total_bytes_transferred;
+  }
+  if (sequential) {
+    constexpr size_t kReadaheadBlocks = 4;
+    PrefetchRange(filename, finish, kReadaheadBlocks * block_size_);
+  }
   return Status::OK();
 }
 
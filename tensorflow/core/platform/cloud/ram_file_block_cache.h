@@ -20,6 +20,7 @@ limitations under the License.
 #include <list>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -72,6 +73,11 @@ class RamFileBlockCache : public FileBlockCache {
       // notification and returns.
       pruning_thread_.reset();
     }
+    // Wait out any in-flight asynchronous prefetches; they reference *this.
+    mutex_lock l(mu_);
+    while (pending_prefetches_ > 0) {
+      prefetch_done_.wait(l);
+    }
   }
 
   /// Read `n` bytes from `filename` starting at `offset` into `out`. This
@@ -91,6 +97,16 @@ class RamFileBlockCache : public FileBlockCache {
   Status Read(const string& filename, size_t offset, size_t n, char* buffer,
               size_t* bytes_transferred) override;
 
+  /// Asynchronously fetches the blocks covering `[offset, offset + len)` of
+  /// `filename` into the cache, so that subsequent Read calls for that range
+  /// hit warm blocks instead of serializing behind cold remote round trips.
+  /// Reads that follow a sequential pattern trigger this automatically for
+  /// the next blocks; this entry point lets callers with known access plans
+  /// warm arbitrary ranges. Fetch errors are swallowed (the corresponding
+  /// Read will surface them).
+  void PrefetchRange(const string& filename, size_t offset, size_t len)
+      TF_LOCKS_EXCLUDED(mu_);
+
   // Validate the given file signature with the existing file signature in the
   // cache. Returns true if the signature doesn't change or the file doesn't
   // exist before. If the signature changes, update the existing signature with
@@ -215,6 +231,10 @@ class RamFileBlockCache : public FileBlockCache {
   /// cache size accordingly.
   void RemoveBlock(BlockMap::iterator entry) TF_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  /// Schedules an asynchronous fetch of `key` if it is not already cached or
+  /// being prefetched.
+  void MaybePrefetchBlock(const Key& key) TF_LOCKS_EXCLUDED(mu_);
+
   /// The cache pruning thread that removes files with expired blocks.
   std::unique_ptr<Thread> pruning_thread_;
 
@@ -224,6 +244,14 @@ class RamFileBlockCache : public FileBlockCache {
   /// Guards access to the block map, LRU list, and cached byte count.
   mutable mutex mu_;
 
+  // Readahead state: end offset of the last read per file (for sequential
+  // pattern detection), keys currently being prefetched, and the in-flight
+  // prefetch count the destructor drains.
+  std::map<string, size_t> last_read_end_ TF_GUARDED_BY(mu_);
+  std::set<Key> prefetches_in_flight_ TF_GUARDED_BY(mu_);
+  int64_t pending_prefetches_ TF_GUARDED_BY(mu_) = 0;
+  condition_variable prefetch_done_;
+
   /// The block map (map from Key to Block).
   BlockMap block_map_ TF_GUARDED_BY(mu_);
 
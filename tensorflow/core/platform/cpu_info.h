@@ -122,6 +122,11 @@ enum CPUFeature {
   AVX512IFMA = 35,     // Integer multiply-add
   AVX512_4VNNIW = 36,  // Integer neural network
   AVX512_4FMAPS = 37,  // Floating point neural network
+  AVX512_BF16 = 38,    // bfloat16 convert/dot-product instructions
+
+  // AMX: tile registers and tile compute (Sapphire Rapids and later).
+  AMX_TILE = 39,  // Tile configuration and load/store
+  AMX_BF16 = 40,  // Tile computation on bfloat16
 };
 
 // Checks whether the current processor supports one of the features above.
@@ -96,6 +96,19 @@ class PosixRandomAccessFile : public RandomAccessFile {
     return s;
   }
 
+  void ReadAsync(uint64 offset, size_t n, char* scratch,
+                 ReadCallback done) const override {
+    // pread has no kernel-level async form here; run it on a background
+    // closure so callers can keep multiple reads in flight instead of
+    // stacking worker threads in I/O wait.
+    Env::Default()->SchedClosure([this, offset, n, scratch,
+                                  done = std::move(done)]() {
+      StringPiece result;
+      Status status = Read(offset, n, &result, scratch);
+      done(status, result);
+    });
+  }
+
 #if defined(TF_CORD_SUPPORT)
   Status Read(uint64 offset, size_t n, absl::Cord* cord) const override {
     if (n == 0) {
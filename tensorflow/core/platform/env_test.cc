@@ -21,6 +21,7 @@ limitations under the License.
 #include "tensorflow/core/framework/node_def.pb.h"
 #include "tensorflow/core/lib/core/status_test_util.h"
 #include "tensorflow/core/platform/cord.h"
+#include "tensorflow/core/platform/notification.h"
 #include "tensorflow/core/platform/null_file_system.h"
 #include "tensorflow/core/platform/path.h"
 #include "tensorflow/core/platform/protobuf.h"
@@ -90,6 +91,52 @@ TEST_F(DefaultEnvTest, IncompleteReadOutOfRange) {
   EXPECT_EQ(input, result);
 }
 
+TEST_F(DefaultEnvTest, ReadAsync) {
+  const string filename = io::JoinPath(BaseDir(), "read_async");
+  const string input = CreateTestFile(env_, filename, 16);
+  std::unique_ptr<RandomAccessFile> f;
+  TF_EXPECT_OK(env_->NewRandomAccessFile(filename, &f));
+
+  // Two overlapping asynchronous reads of disjoint ranges.
+  char scratch_a[8];
+  char scratch_b[8];
+  Status status_a;
+  Status status_b;
+  string result_a;
+  string result_b;
+  Notification done_a;
+  Notification done_b;
+  f->ReadAsync(0, 8, scratch_a,
+               [&](const Status& s, StringPiece result) {
+                 status_a = s;
+                 result_a = string(result);
+                 done_a.Notify();
+               });
+  f->ReadAsync(8, 8, scratch_b,
+               [&](const Status& s, StringPiece result) {
+                 status_b = s;
+                 result_b = string(result);
+                 done_b.Notify();
+               });
+  done_a.WaitForNotification();
+  done_b.WaitForNotification();
+  TF_EXPECT_OK(status_a);
+  TF_EXPECT_OK(status_b);
+  EXPECT_EQ(input.substr(0, 8), result_a);
+  EXPECT_EQ(input.substr(8, 8), result_b);
+
+  // Reading past EOF reports OUT_OF_RANGE through the callback.
+  char scratch_c[8];
+  Status status_c;
+  Notification done_c;
+  f->ReadAsync(12, 8, scratch_c, [&](const Status& s, StringPiece result) {
+    status_c = s;
+    done_c.Notify();
+  });
+  done_c.WaitForNotification();
+  EXPECT_EQ(error::OUT_OF_RANGE, status_c.code());
+}
+
 TEST_F(DefaultEnvTest, ReadFileToString) {
   for (const int length : {0, 1, 1212, 2553, 4928, 8196, 9000, (1 << 20) - 1,
                            1 << 20, (1 << 20) + 1, (256 << 20) + 100}) {
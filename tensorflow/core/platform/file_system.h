@@ -784,6 +784,27 @@ class RandomAccessFile {
   }
 #endif
 
+  /// Callback for ReadAsync: receives the read status and the result piece
+  /// (which may point into the caller-provided scratch buffer, with the same
+  /// lifetime contract as Read).
+  typedef std::function<void(const tensorflow::Status&, StringPiece)>
+      ReadCallback;
+
+  /// \brief Asynchronous variant of Read.
+  ///
+  /// Issues the read of `[offset, offset + n)` into `scratch` and invokes
+  /// `done` with the status and result when it completes; `scratch` (and
+  /// this file) must stay live until `done` runs. Callers may have multiple
+  /// reads outstanding. The base implementation performs the blocking Read
+  /// on the calling thread and invokes `done` inline; filesystems with
+  /// native or offloaded asynchronous I/O override it.
+  virtual void ReadAsync(uint64 offset, size_t n, char* scratch,
+                         ReadCallback done) const {
+    StringPiece result;
+    tensorflow::Status status = Read(offset, n, &result, scratch);
+    done(status, result);
+  }
+
  private:
   TF_DISALLOW_COPY_AND_ASSIGN(RandomAccessFile);
 };
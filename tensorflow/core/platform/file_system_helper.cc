@@ -15,17 +15,22 @@ limitations under the License.
 
 #include "tensorflow/core/platform/file_system_helper.h"
 
+#include <cstdlib>
 #include <deque>
 #include <string>
 #include <vector>
 
+#include "absl/strings/str_split.h"
 #include "tensorflow/core/platform/cpu_info.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/file_system.h"
 #include "tensorflow/core/platform/mutex.h"
 #include "tensorflow/core/platform/path.h"
 #include "tensorflow/core/platform/platform.h"
 #include "tensorflow/core/platform/status.h"
+#include "tensorflow/core/platform/stringprintf.h"
+#include "tensorflow/core/platform/strcat.h"
 #include "tensorflow/core/platform/str_util.h"
 #include "tensorflow/core/platform/threadpool.h"
 
@@ -134,6 +139,32 @@ Status GetMatchingPaths(FileSystem* fs, Env* env, const string& pattern,
     return Status::OK();
   }
 
+  // Persistent manifest cache: with TF_MATCHING_FILES_CACHE_DIR set, the
+  // expanded path list for a pattern is stored on local disk and reused on
+  // subsequent expansions (e.g. job restarts over a fixed training fileset),
+  // which replaces O(files) remote list/stat round trips with one local
+  // read. The cache asserts fileset immutability; jobs over growing
+  // filesets must not enable it. Entries are plain newline-separated path
+  // lists keyed by a fingerprint of the pattern.
+  static const char* cache_dir = std::getenv("TF_MATCHING_FILES_CACHE_DIR");
+  string cache_path;
+  if (cache_dir != nullptr) {
+    cache_path = strings::Printf(
+        "%s/matching_files_%016llx.txt", cache_dir,
+        static_cast<unsigned long long>(Fingerprint64(pattern)));
+    string cached;
+    if (ReadFileToString(env, cache_path, &cached).ok()) {
+      for (absl::string_view line : absl::StrSplit(cached, '\n')) {
+        if (!line.empty()) {
+          results->push_back(string(line));
+        }
+      }
+      VLOG(1) << "Expanded " << pattern << " from manifest cache ("
+              << results->size() << " files).";
+      return Status::OK();
+    }
+  }
+
   // The pattern can contain globbing characters at multiple levels, e.g.:
   //
   //   foo/ba?/baz/f*r
@@ -262,6 +293,23 @@ Status GetMatchingPaths(FileSystem* fs, Env* env, const string& pattern,
     std::swap(expand_queue, next_expand_queue);
   }
 
+  if (!cache_path.empty()) {
+    string manifest;
+    for (const string& path : *results) {
+      manifest.append(path);
+      manifest.push_back('\n');
+    }
+    const string tmp_path = strings::StrCat(cache_path, ".tmp");
+    Status save_status = WriteStringToFile(env, tmp_path, manifest);
+    if (save_status.ok()) {
+      save_status = env->RenameFile(tmp_path, cache_path);
+    }
+    if (!save_status.ok()) {
+      VLOG(1) << "Failed to write matching-files manifest " << cache_path
+              << ": " << save_status;
+    }
+  }
+
   return Status::OK();
 }
 
@@ -22,10 +22,12 @@ limitations under the License.
 #include <algorithm>
 #include <cinttypes>
 #include <cmath>
+#include <cstring>
 #include <locale>
 #include <unordered_map>
 
 #include "double-conversion/double-conversion.h"
+#include "tensorflow/core/platform/byte_order.h"
 #include "tensorflow/core/platform/str_util.h"
 #include "tensorflow/core/platform/logging.h"
 #include "tensorflow/core/platform/macros.h"
@@ -340,6 +342,112 @@ bool safe_strtou32(StringPiece str, uint32* value) {
   return true;
 }
 
+namespace {
+
+// Exact powers of ten; all values are exactly representable in double.
+constexpr double kExactPowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+    1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Returns true iff the eight bytes at `p` are all ASCII digits.
+inline bool IsEightDigits(const char* p) {
+  uint64 chunk;
+  memcpy(&chunk, p, sizeof(chunk));
+  return ((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+          (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ==
+         0x3333333333333333ull;
+}
+
+// Parses the eight ASCII digits at `p` (little-endian SWAR reduction).
+inline uint32 ParseEightDigits(const char* p) {
+  uint64 chunk;
+  memcpy(&chunk, p, sizeof(chunk));
+  chunk = (chunk & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;
+  chunk = (chunk & 0x00FF00FF00FF00FFull) * 6553601 >> 16;
+  return (chunk & 0x0000FFFF0000FFFFull) * 42949672960001 >> 32;
+}
+
+// Shared implementation of the plain-decimal fast path. `kMaxDigits` bounds
+// the total number of significant digits (and therefore fraction digits) so
+// that mantissa / 10^k is computed exactly enough for the target type; see
+// the call sites for the per-type bounds.
+template <int kMaxDigits>
+bool ParsePlainDecimal(StringPiece str, bool* negative, int64_t* mantissa,
+                       int* frac_digits) {
+  const char* p = str.data();
+  const char* end = p + str.size();
+  if (p == end) return false;
+  *negative = (*p == '-');
+  if (*negative || *p == '+') ++p;
+
+  int64_t m = 0;
+  int digits = 0;
+  int frac = 0;
+  bool seen_digit = false;
+  bool seen_dot = false;
+  while (p < end) {
+    const char c = *p;
+    if (c >= '0' && c <= '9') {
+      if (port::kLittleEndian && end - p >= 8 && digits + 8 <= kMaxDigits &&
+          IsEightDigits(p)) {
+        m = m * 100000000 + ParseEightDigits(p);
+        digits += 8;
+        if (seen_dot) frac += 8;
+        seen_digit = true;
+        p += 8;
+        continue;
+      }
+      if (++digits > kMaxDigits) return false;
+      m = m * 10 + (c - '0');
+      seen_digit = true;
+      if (seen_dot) ++frac;
+    } else if (c == '.' && !seen_dot) {
+      seen_dot = true;
+    } else {
+      return false;
+    }
+    ++p;
+  }
+  if (!seen_digit) return false;
+  *mantissa = m;
+  *frac_digits = frac;
+  return true;
+}
+
+}  // namespace
+
+bool fast_strtof_plain(StringPiece str, float* value) {
+  bool negative;
+  int64_t mantissa;
+  int frac_digits;
+  // With at most 7 significant digits both the mantissa and the power of ten
+  // are exactly representable as floats, so the correctly-rounded double
+  // quotient rounds to the correctly-rounded float (double rounding is
+  // innocuous for quotients when the wider format carries 2p+2 bits).
+  if (!ParsePlainDecimal<7>(str, &negative, &mantissa, &frac_digits)) {
+    return false;
+  }
+  double result = static_cast<double>(mantissa);
+  if (frac_digits > 0) result /= kExactPowersOfTen[frac_digits];
+  *value = static_cast<float>(negative ? -result : result);
+  return true;
+}
+
+bool fast_strtod_plain(StringPiece str, double* value) {
+  bool negative;
+  int64_t mantissa;
+  int frac_digits;
+  // Up to 15 significant digits: the mantissa (< 2^53) and the power of ten
+  // are exact in double, so the quotient is the correctly-rounded result.
+  if (!ParsePlainDecimal<15>(str, &negative, &mantissa, &frac_digits)) {
+    return false;
+  }
+  double result = static_cast<double>(mantissa);
+  if (frac_digits > 0) result /= kExactPowersOfTen[frac_digits];
+  *value = negative ? -result : result;
+  return true;
+}
+
 bool safe_strtof(StringPiece str, float* value) {
   int processed_characters_count = -1;
   auto len = str.size();
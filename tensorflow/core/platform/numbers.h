@@ -123,6 +123,19 @@ bool safe_strtof(StringPiece str, float* value);
 // Returns false on invalid input or if `strlen(value) >= kFastToBufferSize`.
 bool safe_strtod(StringPiece str, double* value);
 
+// Fast-path variants of safe_strtof/safe_strtod for the common plain-decimal
+// form: optional sign, digits, optional '.' and fraction digits; no
+// whitespace, exponent, hex, inf/nan or quoting. Inputs outside that form,
+// or with enough digits to risk a rounding difference, return false without
+// touching *value so that callers can fall back to the full parser. For
+// every accepted input the result is bit-identical to the full parser.
+//
+// Digit runs are consumed eight at a time with a SWAR multiply on
+// little-endian targets, which is markedly faster than per-character parsing
+// for CSV-style numeric columns.
+bool fast_strtof_plain(StringPiece str, float* value);
+bool fast_strtod_plain(StringPiece str, double* value);
+
 inline bool ProtoParseNumeric(StringPiece s, int32* value) {
   return safe_strto32(s, value);
 }
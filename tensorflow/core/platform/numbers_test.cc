@@ -320,6 +320,70 @@ TEST(safe_strtof, Float) {
   EXPECT_TRUE(std::isnan(result));
 }
 
+TEST(fast_strtof_plain, Float) {
+  float result = 0;
+
+  EXPECT_TRUE(fast_strtof_plain("0.123456", &result));
+  EXPECT_EQ(0.123456f, result);
+
+  EXPECT_TRUE(fast_strtof_plain("-1234.5", &result));
+  EXPECT_EQ(-1234.5f, result);
+
+  EXPECT_TRUE(fast_strtof_plain("+42", &result));
+  EXPECT_EQ(42.0f, result);
+
+  // Longer digit runs exercise the SWAR path.
+  EXPECT_TRUE(fast_strtof_plain("1234567", &result));
+  EXPECT_EQ(1234567.0f, result);
+
+  // Everything the fast path accepts must match the full parser exactly.
+  for (const char* input :
+       {"0", "1", "-1", "3.14159", "0.5", "2500000", "-0.0625", "999.999"}) {
+    float fast = 0;
+    float full = 0;
+    ASSERT_TRUE(fast_strtof_plain(input, &fast)) << input;
+    ASSERT_TRUE(safe_strtof(input, &full)) << input;
+    EXPECT_EQ(full, fast) << input;
+  }
+
+  // Rejected forms fall back to the full parser.
+  EXPECT_FALSE(fast_strtof_plain("", &result));
+  EXPECT_FALSE(fast_strtof_plain("-", &result));
+  EXPECT_FALSE(fast_strtof_plain(".", &result));
+  EXPECT_FALSE(fast_strtof_plain("1e10", &result));
+  EXPECT_FALSE(fast_strtof_plain(" 1", &result));
+  EXPECT_FALSE(fast_strtof_plain("1 ", &result));
+  EXPECT_FALSE(fast_strtof_plain("0x1F", &result));
+  EXPECT_FALSE(fast_strtof_plain("inf", &result));
+  EXPECT_FALSE(fast_strtof_plain("nan", &result));
+  EXPECT_FALSE(fast_strtof_plain("1.2.3", &result));
+  // Too many significant digits for the float fast path.
+  EXPECT_FALSE(fast_strtof_plain("12345678", &result));
+}
+
+TEST(fast_strtod_plain, Double) {
+  double result = 0;
+
+  EXPECT_TRUE(fast_strtod_plain("0.1234567890123", &result));
+  EXPECT_EQ(0.1234567890123, result);
+
+  EXPECT_TRUE(fast_strtod_plain("-123456789012345", &result));
+  EXPECT_EQ(-123456789012345.0, result);
+
+  for (const char* input :
+       {"0", "-0.5", "3.141592653589", "123456.789012", "99999999.9999999"}) {
+    double fast = 0;
+    double full = 0;
+    ASSERT_TRUE(fast_strtod_plain(input, &fast)) << input;
+    ASSERT_TRUE(safe_strtod(input, &full)) << input;
+    EXPECT_EQ(full, fast) << input;
+  }
+
+  EXPECT_FALSE(fast_strtod_plain("1e10", &result));
+  EXPECT_FALSE(fast_strtod_plain(" 1", &result));
+  EXPECT_FALSE(fast_strtod_plain("1234567890123456", &result));
+}
+
 TEST(safe_strtod, Double) {
   double result = 0;
 
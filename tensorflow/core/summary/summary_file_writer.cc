@@ -14,6 +14,9 @@ limitations under the License.
 ==============================================================================*/
 #include "tensorflow/core/summary/summary_file_writer.h"
 
+#include <cstdlib>
+#include <cstring>
+
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "tensorflow/core/framework/graph.pb.h"
@@ -70,6 +73,16 @@ class SummaryFileWriter : public SummaryWriterInterface {
     if (!is_initialized_) {
       return errors::FailedPrecondition("Class was not properly initialized.");
     }
+    // Wait out any background batch so explicit flushes keep their
+    // everything-durable contract, then drain synchronously.
+    while (flush_in_flight_) {
+      flush_done_.wait(ml);
+    }
+    if (!deferred_flush_status_.ok()) {
+      Status s = deferred_flush_status_;
+      deferred_flush_status_ = Status::OK();
+      return s;
+    }
     return InternalFlush();
   }
 
@@ -151,10 +164,58 @@ class SummaryFileWriter : public SummaryWriterInterface {
 
   Status WriteEvent(std::unique_ptr<Event> event) override {
     mutex_lock ml(mu_);
+    // Surface any failure from a previous background flush on the producer
+    // path, so errors are not silently dropped.
+    if (!deferred_flush_status_.ok()) {
+      Status s = deferred_flush_status_;
+      deferred_flush_status_ = Status::OK();
+      return s;
+    }
     queue_.emplace_back(std::move(event));
     if (queue_.size() > max_queue_ ||
         env_->NowMicros() - last_flush_ > 1000 * flush_millis_) {
-      return InternalFlush();
+      // With TF_ASYNC_SUMMARY_WRITES=1, serialization and file I/O happen
+      // on a background closure: the queued batch is handed off under the
+      // lock and written outside it, so training threads logging thousands
+      // of metrics per step pay queue appends only. One batch is in flight
+      // at a time, which preserves event order; explicit Flush() still
+      // drains synchronously.
+      static const bool async_writes = [] {
+        const char* value = std::getenv("TF_ASYNC_SUMMARY_WRITES");
+        return value != nullptr && strcmp(value, "1") == 0;
+      }();
+      if (!async_writes) {
+        return InternalFlush();
+      }
+      if (!flush_in_flight_) {
+        flush_in_flight_ = true;
+        last_flush_ = env_->NowMicros();
+        std::vector<std::unique_ptr<Event>> batch;
+        batch.swap(queue_);
+        Ref();  // Released by the closure; keeps *this alive.
+        auto* shared_batch =
+            new std::vector<std::unique_ptr<Event>>(std::move(batch));
+        env_->SchedClosure([this, shared_batch]() {
+          // Safe without mu_: flush_in_flight_ excludes every other writer
+          // of events_writer_ (queue appends never touch it, and Flush()
+          // waits for this batch), so the serialization and file I/O run
+          // outside the producers' lock.
+          for (const std::unique_ptr<Event>& e : *shared_batch) {
+            events_writer_->WriteEvent(*e);
+          }
+          Status status = events_writer_->Flush();
+          {
+            mutex_lock ml(mu_);
+            flush_in_flight_ = false;
+            if (!status.ok()) {
+              deferred_flush_status_ = status;
+            }
+            flush_done_.notify_all();
+          }
+          delete shared_batch;
+          Unref();
+        });
+      }
     }
     return Status::OK();
   }
@@ -183,6 +244,10 @@ class SummaryFileWriter : public SummaryWriterInterface {
   uint64 last_flush_;
   Env* env_;
   mutex mu_;
+  // Async-flush state; see WriteEvent.
+  bool flush_in_flight_ TF_GUARDED_BY(mu_) = false;
+  Status deferred_flush_status_ TF_GUARDED_BY(mu_);
+  condition_variable flush_done_;
   std::vector<std::unique_ptr<Event>> queue_ TF_GUARDED_BY(mu_);
   // A pointer to allow deferred construction.
   std::unique_ptr<EventsWriter> events_writer_ TF_GUARDED_BY(mu_);
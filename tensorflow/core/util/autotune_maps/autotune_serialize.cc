@@ -16,6 +16,8 @@ limitations under the License.
 // For Google-internal use only.
 #include "tensorflow/core/util/autotune_maps/autotune_serialize.h"
 
+#include "tensorflow/core/platform/env.h"
+
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -209,4 +211,22 @@ void ResetAutotuneMaps() {
 #endif  // GOOGLE_CUDA || TENSORFLOW_USE_ROCM
 }
 
+Status LoadAutotuneMapsFromFile(const std::string& file_name) {
+  if (!Env::Default()->FileExists(file_name).ok()) {
+    // Nothing persisted yet; the caller autotunes from scratch.
+    return Status::OK();
+  }
+  std::string serialized;
+  TF_RETURN_IF_ERROR(ReadFileToString(Env::Default(), file_name, &serialized));
+  return LoadSerializedAutotuneMaps(serialized);
+}
+
+Status SaveAutotuneMapsToFile(const std::string& file_name) {
+  std::string serialized;
+  TF_RETURN_IF_ERROR(SerializeAutotuneMaps(&serialized));
+  const std::string tmp_name = file_name + ".tmp";
+  TF_RETURN_IF_ERROR(WriteStringToFile(Env::Default(), tmp_name, serialized));
+  return Env::Default()->RenameFile(tmp_name, file_name);
+}
+
 }  // namespace tensorflow
@@ -32,6 +32,17 @@ limitations under the License.
 namespace tensorflow {
 
 // TODO(b/189530096) Support autotune maps for more ops.
+// Convenience persistence on top of the two primitives below: loads the
+// autotune database from `file_name` if it exists (missing files are not an
+// error, so first runs proceed to autotune normally), and saves the current
+// maps to `file_name` (via a temp file and rename, so concurrent readers
+// never see partial databases). Production jobs call Load after device
+// initialization and Save after warmup (or periodically); entries are keyed
+// by device identity internally, so a database from different GPU hardware
+// simply misses.
+Status LoadAutotuneMapsFromFile(const std::string& file_name);
+Status SaveAutotuneMapsToFile(const std::string& file_name);
+
 // Loads autotune maps from string output by SerializeAutotuneMaps and uses
 // them to update the runtime autotune maps.
 Status LoadSerializedAutotuneMaps(absl::string_view s);
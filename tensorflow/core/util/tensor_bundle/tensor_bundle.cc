@@ -22,6 +22,8 @@ limitations under the License.
 #include <utility>
 
 #include "tensorflow/core/framework/register_types.h"
+#include "tensorflow/core/framework/tensor_util.h"
+#include "tensorflow/core/lib/core/threadpool.h"
 #include "tensorflow/core/framework/tensor.pb.h"
 #include "tensorflow/core/framework/tensor_shape.pb.h"
 #include "tensorflow/core/framework/types.h"
@@ -692,6 +694,141 @@ static Status MergeOneBundle(Env* env, StringPiece prefix,
   return Status::OK();
 }
 
+Status DeltaBundleWriter::Save(
+    StringPiece prefix, const std::vector<std::pair<string, Tensor>>& entries) {
+  BundleWriter writer(env_, prefix);
+  TF_RETURN_IF_ERROR(writer.status());
+  int64_t written = 0;
+  for (const auto& key_and_tensor : entries) {
+    const string& key = key_and_tensor.first;
+    const Tensor& tensor = key_and_tensor.second;
+    bool changed = true;
+    if (DataTypeCanUseMemcpy(tensor.dtype())) {
+      const Fprint128 fingerprint = Fingerprint128(tensor.tensor_data());
+      auto it = last_fingerprints_.find(key);
+      changed = (it == last_fingerprints_.end() ||
+                 it->second.low64 != fingerprint.low64 ||
+                 it->second.high64 != fingerprint.high64);
+      last_fingerprints_[key] = fingerprint;
+    }
+    if (changed) {
+      TF_RETURN_IF_ERROR(writer.Add(key, tensor));
+      ++written;
+    }
+  }
+  VLOG(1) << "Delta checkpoint " << prefix << ": wrote " << written << " of "
+          << entries.size() << " tensors.";
+  return writer.Finish();
+}
+
+Status BundleReadAll(Env* env, StringPiece prefix,
+                     const std::vector<string>& keys,
+                     std::vector<Tensor>* values, int num_workers) {
+  values->clear();
+  values->resize(keys.size());
+  if (keys.empty()) return Status::OK();
+  num_workers = std::max<int>(
+      1, std::min<int>(num_workers, static_cast<int>(keys.size())));
+
+  std::vector<Status> statuses(num_workers);
+  auto read_range = [&](int worker) {
+    const size_t begin = keys.size() * worker / num_workers;
+    const size_t end = keys.size() * (worker + 1) / num_workers;
+    BundleReader reader(env, prefix);
+    Status status = reader.status();
+    if (!status.ok()) {
+      statuses[worker] = status;
+      return;
+    }
+    std::vector<size_t> order;
+    order.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) order.push_back(i);
+    // Sorting by shard and offset turns this worker's lookups into a
+    // sequential sweep of the data files.
+    status = reader.SortForSequentialAccess<size_t>(
+        order, [&keys](size_t i) { return keys[i]; });
+    for (size_t i : order) {
+      if (!status.ok()) break;
+      status = reader.Lookup(keys[i], &(*values)[i]);
+    }
+    statuses[worker] = status;
+  };
+
+  if (num_workers == 1) {
+    read_range(0);
+  } else {
+    thread::ThreadPool pool(env, "bundle_read_all", num_workers);
+    for (int worker = 1; worker < num_workers; ++worker) {
+      pool.Schedule([&read_range, worker]() { read_range(worker); });
+    }
+    read_range(0);
+    // The pool joins its threads on destruction.
+  }
+  for (const Status& status : statuses) {
+    TF_RETURN_IF_ERROR(status);
+  }
+  return Status::OK();
+}
+
+AsyncBundleWriter::AsyncBundleWriter(Env* env, StringPiece prefix,
+                                     const BundleWriter::Options& options)
+    : env_(env), prefix_(prefix), options_(options) {}
+
+AsyncBundleWriter::~AsyncBundleWriter() {
+  if (finish_called_) {
+    WaitForCompletion().IgnoreError();
+  }
+}
+
+Status AsyncBundleWriter::Add(StringPiece key, const Tensor& val,
+                              bool share_buffer) {
+  if (finish_called_) {
+    return errors::FailedPrecondition(
+        "AsyncBundleWriter::Add called after FinishAsync");
+  }
+  if (share_buffer) {
+    entries_.emplace_back(string(key), val);
+  } else {
+    entries_.emplace_back(string(key), tensor::DeepCopy(val));
+  }
+  return Status::OK();
+}
+
+void AsyncBundleWriter::FinishAsync(std::function<void(const Status&)> done) {
+  DCHECK(!finish_called_);
+  finish_called_ = true;
+  writer_thread_.reset(env_->StartThread(
+      {}, "async_bundle_writer", [this, done = std::move(done)]() {
+        BundleWriter writer(env_, prefix_, options_);
+        Status status = writer.status();
+        for (auto& key_and_tensor : entries_) {
+          if (!status.ok()) break;
+          status = writer.Add(key_and_tensor.first, key_and_tensor.second);
+          // Release each (possibly deep-copied) tensor as soon as it has
+          // been written, so the snapshot's extra memory drains during the
+          // write instead of at the end.
+          key_and_tensor.second = Tensor();
+        }
+        if (status.ok()) {
+          status = writer.Finish();
+        }
+        status_ = status;
+        done_.Notify();
+        if (done) {
+          done(status_);
+        }
+      }));
+}
+
+Status AsyncBundleWriter::WaitForCompletion() {
+  if (!finish_called_) {
+    return errors::FailedPrecondition(
+        "AsyncBundleWriter::WaitForCompletion called before FinishAsync");
+  }
+  done_.WaitForNotification();
+  return status_;
+}
+
 Status MergeBundles(Env* env, gtl::ArraySlice<tstring> prefixes,
                     StringPiece merged_prefix) {
   // Merges all metadata tables.
@@ -748,7 +885,6 @@ BundleReader::BundleReader(Env* env, StringPiece prefix)
       prefix_(prefix),
       metadata_(nullptr),
       table_(nullptr),
-      index_cache_(nullptr),
       iter_(nullptr),
       need_to_swap_bytes_(false) {
   const string filename = MetaFilename(prefix_);
@@ -763,13 +899,21 @@ BundleReader::BundleReader(Env* env, StringPiece prefix)
   metadata_ = wrapper.release();
 
   table::Options o;
-  int64_t cache_size;
-  Status s =
-      ReadInt64FromEnvVar("TF_TABLE_INDEX_CACHE_SIZE_IN_MB", 0, &cache_size);
-  if (s.ok() && cache_size > 0) {
-    index_cache_ = table::NewLRUCache(cache_size << 20);
-    o.block_cache = index_cache_;
-  }
+  // One charge-based LRU cache shared by every reader in the process (sized
+  // by TF_TABLE_INDEX_CACHE_SIZE_IN_MB): concurrent and repeated restores of
+  // the same bundles cache each metadata block once instead of once per
+  // reader. The cache is intentionally never destroyed; readers do not own
+  // it.
+  static table::Cache* const shared_index_cache = [] () -> table::Cache* {
+    int64_t cache_size;
+    Status s =
+        ReadInt64FromEnvVar("TF_TABLE_INDEX_CACHE_SIZE_IN_MB", 0, &cache_size);
+    if (s.ok() && cache_size > 0) {
+      return table::NewLRUCache(cache_size << 20);
+    }
+    return nullptr;
+  }();
+  o.block_cache = shared_index_cache;
 
   status_ = table::Table::Open(o, metadata_, file_size, &table_);
   if (!status_.ok()) return;
@@ -802,9 +946,6 @@ BundleReader::~BundleReader() {
   delete metadata_;
   delete iter_;
   delete table_;
-  if (index_cache_) {
-    delete index_cache_;
-  }
   // InputBuffer does not own the underlying RandomAccessFile.
   for (auto pair : data_) {
     if (pair.second != nullptr && pair.second->file() != nullptr) {
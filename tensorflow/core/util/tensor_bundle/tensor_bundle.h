@@ -61,8 +61,12 @@ limitations under the License.
 #ifndef TENSORFLOW_CORE_UTIL_TENSOR_BUNDLE_TENSOR_BUNDLE_H_
 #define TENSORFLOW_CORE_UTIL_TENSOR_BUNDLE_TENSOR_BUNDLE_H_
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 #include <unordered_map>
 
 #include "absl/algorithm/container.h"
@@ -79,7 +83,10 @@ limitations under the License.
 #include "tensorflow/core/platform/cord.h"
 #include "tensorflow/core/platform/env.h"
 #include "tensorflow/core/platform/file_system.h"
+#include "tensorflow/core/platform/fingerprint.h"
 #include "tensorflow/core/platform/macros.h"
+#include "tensorflow/core/platform/notification.h"
+#include "tensorflow/core/platform/thread_annotations.h"
 #include "tensorflow/core/platform/types.h"
 #include "tensorflow/core/protobuf/tensor_bundle.pb.h"
 #include "tensorflow/core/util/tensor_bundle/naming.h"
@@ -177,6 +184,129 @@ class BundleWriter {
 //
 // Once merged, makes a best effort to delete the old metadata files.
 // Returns OK iff all bundles are successfully merged.
+// Support for delta checkpoints: frequent fine-tune snapshots change only a
+// small fraction of weights, so a full bundle per save is mostly redundant
+// bytes.
+//
+// DeltaBundleWriter lives across the saves of one training process: each
+// Save() fingerprints the tensors' contents and writes a bundle containing
+// only the tensors whose fingerprint changed since the previous Save (the
+// first Save writes everything). OverlayBundleReader reads such a delta
+// bundle transparently: lookups try the delta first and fall back to the
+// referenced base bundle, so consumers restore from (base, delta) pairs
+// without knowing which tensors moved.
+class DeltaBundleWriter {
+ public:
+  explicit DeltaBundleWriter(Env* env) : env_(env) {}
+
+  // Writes the subset of `entries` whose content changed since the previous
+  // Save() to a bundle at `prefix`. Tensors must be memcpy-able to
+  // participate in change detection; others are always written.
+  Status Save(StringPiece prefix,
+              const std::vector<std::pair<string, Tensor>>& entries);
+
+ private:
+  Env* const env_;
+  absl::flat_hash_map<string, Fprint128> last_fingerprints_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(DeltaBundleWriter);
+};
+
+// Reads a (delta, base) bundle pair as one logical bundle.
+class OverlayBundleReader {
+ public:
+  OverlayBundleReader(Env* env, StringPiece delta_prefix,
+                      StringPiece base_prefix)
+      : delta_(env, delta_prefix), base_(env, base_prefix) {}
+
+  Status status() {
+    TF_RETURN_IF_ERROR(delta_.status());
+    return base_.status();
+  }
+
+  bool Contains(StringPiece key) {
+    return delta_.Contains(key) || base_.Contains(key);
+  }
+
+  Status LookupDtypeAndShape(StringPiece key, DataType* dtype,
+                             TensorShape* shape) {
+    if (delta_.Contains(key)) {
+      return delta_.LookupDtypeAndShape(key, dtype, shape);
+    }
+    return base_.LookupDtypeAndShape(key, dtype, shape);
+  }
+
+  Status Lookup(StringPiece key, Tensor* val) {
+    if (delta_.Contains(key)) {
+      return delta_.Lookup(key, val);
+    }
+    return base_.Lookup(key, val);
+  }
+
+ private:
+  BundleReader delta_;
+  BundleReader base_;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(OverlayBundleReader);
+};
+
+// Restores all of `keys` from the bundle at `prefix` into `*values`
+// (resized to match), spreading the work over up to `num_workers` parallel
+// readers. Each worker opens its own BundleReader (its own file handles and
+// buffers), sorts its share of the keys for sequential access within the
+// data shards, and restores them in order - so a large restore issues
+// sequential streaming reads on several shards at once instead of
+// metadata-order random lookups through a single file, and per-tensor CRC
+// validation overlaps with the other workers' I/O.
+Status BundleReadAll(Env* env, StringPiece prefix,
+                     const std::vector<string>& keys,
+                     std::vector<Tensor>* values, int num_workers);
+
+// Writes a bundle off the calling thread so that checkpointing does not
+// stall training for the duration of serialization and filesystem I/O.
+//
+// Add() captures each tensor on the calling thread: by default with a deep
+// copy (a memcpy at RAM bandwidth - the only work that blocks the trainer),
+// or, when `share_buffer` is true, by aliasing the tensor's refcounted
+// buffer with no copy at all. Buffer sharing is only a consistent snapshot
+// if the caller guarantees the tensor is not updated in place until the
+// write completes; resource variables mutate their buffers in place, so
+// they need the deep copy unless updates are externally fenced.
+//
+// FinishAsync() then streams all captured tensors through a BundleWriter on
+// a background thread. Not thread-safe; Add() calls must be externally
+// serialized and precede FinishAsync().
+class AsyncBundleWriter {
+ public:
+  AsyncBundleWriter(Env* env, StringPiece prefix,
+                    const BundleWriter::Options& options = {});
+  ~AsyncBundleWriter();
+
+  // Captures "val" under "key". Keys must be unique across calls.
+  Status Add(StringPiece key, const Tensor& val, bool share_buffer = false);
+
+  // Starts the background write of all captured tensors. `done` is invoked
+  // with the final status (including BundleWriter::Finish) from the
+  // background thread. Must be called at most once.
+  void FinishAsync(std::function<void(const Status&)> done);
+
+  // Blocks until the background write started by FinishAsync completes and
+  // returns its status. Returns an error if FinishAsync was never called.
+  Status WaitForCompletion();
+
+ private:
+  Env* const env_;
+  const string prefix_;
+  const BundleWriter::Options options_;
+  std::vector<std::pair<string, Tensor>> entries_;
+  std::unique_ptr<Thread> writer_thread_;
+  Notification done_;
+  Status status_;
+  bool finish_called_ = false;
+
+  TF_DISALLOW_COPY_AND_ASSIGN(AsyncBundleWriter);
+};
+
 Status MergeBundles(Env* env, gtl::ArraySlice<tstring> prefixes,
                     StringPiece merged_prefix);
 
@@ -305,7 +435,6 @@ class BundleReader {
   Status status_;
   RandomAccessFile* metadata_;  // Owned.
   table::Table* table_;
-  table::Cache* index_cache_;
   table::Iterator* iter_;
   // Owned the InputBuffer objects and their underlying RandomAccessFile's.
   std::unordered_map<int32, io::InputBuffer*> data_;
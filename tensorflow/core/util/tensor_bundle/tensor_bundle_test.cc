@@ -926,6 +926,121 @@ TEST(TensorBundleTest, SortForSequentialAccess) {
                           "tensor-1-2", "tensor-1-1", "tensor-1-0"));
 }
 
+TEST(TensorBundleTest, DeltaSaveOverlayReadRoundTrip) {
+  DeltaBundleWriter writer(Env::Default());
+  Tensor t0 = Constant_2x3(1.f);
+  Tensor t1 = Constant_2x3(2.f);
+  // The first Save has no history, so it writes everything.
+  TF_ASSERT_OK(writer.Save(Prefix("delta_base"), {{"t0", t0}, {"t1", t1}}));
+  {
+    BundleReader base(Env::Default(), Prefix("delta_base"));
+    TF_ASSERT_OK(base.status());
+    EXPECT_TRUE(base.Contains("t0"));
+    EXPECT_TRUE(base.Contains("t1"));
+  }
+
+  // Only t1 changes, so the second Save writes only t1.
+  Tensor t1_new = Constant_2x3(3.f);
+  TF_ASSERT_OK(writer.Save(Prefix("delta_1"), {{"t0", t0}, {"t1", t1_new}}));
+  {
+    BundleReader delta(Env::Default(), Prefix("delta_1"));
+    TF_ASSERT_OK(delta.status());
+    EXPECT_FALSE(delta.Contains("t0"));
+    EXPECT_TRUE(delta.Contains("t1"));
+  }
+
+  // The overlay resolves the (delta, base) pair as one logical bundle:
+  // t1 from the delta, t0 through the fallback to the base.
+  OverlayBundleReader overlay(Env::Default(), Prefix("delta_1"),
+                              Prefix("delta_base"));
+  TF_ASSERT_OK(overlay.status());
+  EXPECT_TRUE(overlay.Contains("t0"));
+  EXPECT_TRUE(overlay.Contains("t1"));
+  EXPECT_FALSE(overlay.Contains("no_such_key"));
+  DataType dtype;
+  TensorShape shape;
+  TF_ASSERT_OK(overlay.LookupDtypeAndShape("t1", &dtype, &shape));
+  EXPECT_EQ(dtype, DT_FLOAT);
+  EXPECT_EQ(shape, TensorShape({2, 3}));
+  Tensor val(DT_FLOAT, TensorShape({2, 3}));
+  TF_ASSERT_OK(overlay.Lookup("t0", &val));
+  test::ExpectTensorEqual<float>(val, t0);
+  TF_ASSERT_OK(overlay.Lookup("t1", &val));
+  test::ExpectTensorEqual<float>(val, t1_new);
+}
+
+TEST(TensorBundleTest, BundleReadAll) {
+  std::vector<string> keys;
+  {
+    BundleWriter writer(Env::Default(), Prefix("read_all"));
+    for (int i = 0; i < 16; ++i) {
+      keys.push_back(strings::StrCat("key_", i));
+      TF_ASSERT_OK(writer.Add(keys.back(), Constant_2x3(float(i))));
+    }
+    TF_ASSERT_OK(writer.Finish());
+  }
+  // Single worker and parallel workers must produce identical results, in
+  // the caller's key order.
+  for (int num_workers : {1, 4}) {
+    std::vector<Tensor> values;
+    TF_ASSERT_OK(BundleReadAll(Env::Default(), Prefix("read_all"), keys,
+                               &values, num_workers));
+    ASSERT_EQ(values.size(), keys.size());
+    for (int i = 0; i < 16; ++i) {
+      test::ExpectTensorEqual<float>(values[i], Constant_2x3(float(i)));
+    }
+  }
+}
+
+TEST(TensorBundleTest, BundleReadAllMissingKey) {
+  {
+    BundleWriter writer(Env::Default(), Prefix("read_all_partial"));
+    TF_ASSERT_OK(writer.Add("present", Constant_2x3(1.f)));
+    TF_ASSERT_OK(writer.Finish());
+  }
+  // A missing key in any worker's share must fail the whole read.
+  std::vector<Tensor> values;
+  Status status = BundleReadAll(Env::Default(), Prefix("read_all_partial"),
+                                {"present", "missing"}, &values,
+                                /*num_workers=*/2);
+  EXPECT_EQ(status.code(), error::NOT_FOUND);
+}
+
+TEST(TensorBundleTest, AsyncBundleWriter) {
+  Tensor t0 = Constant_2x3(1.f);
+  Tensor t1 = Constant_2x3(2.f);
+  {
+    AsyncBundleWriter writer(Env::Default(), Prefix("async"));
+    TF_ASSERT_OK(writer.Add("t0", t0));
+    TF_ASSERT_OK(writer.Add("t1", t1, /*share_buffer=*/true));
+
+    // Waiting before FinishAsync is a caller error, not a hang.
+    EXPECT_TRUE(errors::IsFailedPrecondition(writer.WaitForCompletion()));
+
+    Status done_status = errors::Unknown("not called");
+    Notification done_called;
+    writer.FinishAsync([&](const Status& s) {
+      done_status = s;
+      done_called.Notify();
+    });
+
+    // Adding after FinishAsync is rejected.
+    EXPECT_TRUE(
+        errors::IsFailedPrecondition(writer.Add("t2", Constant_2x3(3.f))));
+
+    TF_EXPECT_OK(writer.WaitForCompletion());
+    done_called.WaitForNotification();
+    TF_EXPECT_OK(done_status);
+    // WaitForCompletion stays callable after completion.
+    TF_EXPECT_OK(writer.WaitForCompletion());
+  }
+  BundleReader reader(Env::Default(), Prefix("async"));
+  TF_ASSERT_OK(reader.status());
+  Expect<float>(&reader, "t0", t0);
+  Expect<float>(&reader, "t1", t1);
+  EXPECT_FALSE(reader.Contains("t2"));
+}
+
 TEST(TensorBundleTest, Error) {
   {  // Dup keys.
     BundleWriter writer(Env::Default(), Prefix("dup"));
@@ -216,6 +216,21 @@ TfLiteStatus Interpreter::ResizeInputTensorStrict(
   return primary_subgraph().ResizeInputTensorStrict(tensor_index, dims);
 }
 
+TfLiteStatus Interpreter::ResizeInputsBatchDimension(int batch_size) {
+  if (batch_size <= 0) return kTfLiteError;
+  for (int input_index : inputs()) {
+    const TfLiteTensor* input = tensor(input_index);
+    if (input == nullptr) return kTfLiteError;
+    if (input->dims == nullptr || input->dims->size == 0) continue;
+    if (input->dims->data[0] == batch_size) continue;
+    std::vector<int> dims(input->dims->data,
+                          input->dims->data + input->dims->size);
+    dims[0] = batch_size;
+    TF_LITE_ENSURE_STATUS(ResizeInputTensor(input_index, dims));
+  }
+  return AllocateTensors();
+}
+
 TfLiteStatus Interpreter::Invoke() {
   ScopedRuntimeInstrumentationProfile scoped_runtime_event(installed_profiler_,
                                                            "invoke");
@@ -501,6 +501,15 @@ class Interpreter {
   TfLiteStatus ResizeInputTensor(int tensor_index,
                                  const std::vector<int>& dims);
 
+  /// Convenience for batched inference. Resizes the leading (batch)
+  /// dimension of every model input to `batch_size` and reallocates
+  /// tensors, so a single Invoke() processes `batch_size` samples through
+  /// the batch-aware kernels (fully connected, convolution, elementwise)
+  /// instead of paying op dispatch and delegate hand-off once per sample.
+  /// Inputs whose rank is 0 are left untouched. Callers fill the batched
+  /// inputs after this returns and read batched outputs after Invoke().
+  TfLiteStatus ResizeInputsBatchDimension(int batch_size);
+
   /// Change the dimensionality of a given tensor. This is only acceptable for
   /// tensor indices that are inputs or variables. Only unknown dimensions can
   /// be resized with this function. Unknown dimensions are indicated as `-1` in
@@ -890,6 +890,73 @@ TEST(BasicInterpreter, AllocateTwice) {
   ASSERT_EQ(old_tensor1_ptr, interpreter.tensor(1)->data.raw);
 }
 
+TEST(BasicInterpreter, ResizeInputsBatchDimension) {
+  Interpreter interpreter;
+  ASSERT_EQ(interpreter.AddTensors(3), kTfLiteOk);
+  ASSERT_EQ(interpreter.SetInputs({0, 2}), kTfLiteOk);
+  ASSERT_EQ(interpreter.SetOutputs({1}), kTfLiteOk);
+
+  TfLiteQuantizationParams quantized;
+  ASSERT_EQ(interpreter.SetTensorParametersReadWrite(0, kTfLiteFloat32, "",
+                                                     {1, 2}, quantized),
+            kTfLiteOk);
+  ASSERT_EQ(interpreter.SetTensorParametersReadWrite(1, kTfLiteFloat32, "",
+                                                     {1, 2}, quantized),
+            kTfLiteOk);
+  // A scalar input: batch resizing must skip it rather than fail.
+  ASSERT_EQ(interpreter.SetTensorParametersReadWrite(
+                2, kTfLiteFloat32, "", std::vector<int>{}, quantized),
+            kTfLiteOk);
+
+  // A kernel that doubles its input, with the output shaped like the input.
+  TfLiteRegistration reg = {nullptr, nullptr, nullptr, nullptr};
+  reg.prepare = [](TfLiteContext* context, TfLiteNode* node) {
+    const TfLiteTensor* input;
+    TF_LITE_ENSURE_OK(context, GetInputSafe(context, node, 0, &input));
+    TfLiteTensor* output;
+    TF_LITE_ENSURE_OK(context, GetOutputSafe(context, node, 0, &output));
+    return context->ResizeTensor(context, output,
+                                 TfLiteIntArrayCopy(input->dims));
+  };
+  reg.invoke = [](TfLiteContext* context, TfLiteNode* node) {
+    const TfLiteTensor* input;
+    TF_LITE_ENSURE_OK(context, GetInputSafe(context, node, 0, &input));
+    TfLiteTensor* output;
+    TF_LITE_ENSURE_OK(context, GetOutputSafe(context, node, 0, &output));
+    int num = 1;
+    for (int d = 0; d < input->dims->size; ++d) num *= input->dims->data[d];
+    for (int i = 0; i < num; ++i) output->data.f[i] = 2 * input->data.f[i];
+    return kTfLiteOk;
+  };
+  ASSERT_EQ(
+      interpreter.AddNodeWithParameters({0}, {1}, nullptr, 0, nullptr, &reg),
+      kTfLiteOk);
+
+  // Invalid batch sizes are rejected outright.
+  ASSERT_EQ(interpreter.ResizeInputsBatchDimension(0), kTfLiteError);
+  ASSERT_EQ(interpreter.ResizeInputsBatchDimension(-2), kTfLiteError);
+
+  // Resize-then-invoke: the batched leading dimension propagates through
+  // prepare into a batched output.
+  ASSERT_EQ(interpreter.ResizeInputsBatchDimension(4), kTfLiteOk);
+  ASSERT_EQ(interpreter.tensor(0)->dims->data[0], 4);
+  EXPECT_EQ(interpreter.tensor(2)->dims->size, 0);  // Scalar untouched.
+  for (int i = 0; i < 8; ++i) {
+    interpreter.typed_tensor<float>(0)[i] = i;
+  }
+  ASSERT_EQ(interpreter.Invoke(), kTfLiteOk);
+  ASSERT_EQ(interpreter.tensor(1)->dims->size, 2);
+  ASSERT_EQ(interpreter.tensor(1)->dims->data[0], 4);
+  ASSERT_EQ(interpreter.tensor(1)->dims->data[1], 2);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(interpreter.typed_tensor<float>(1)[i], 2 * i);
+  }
+
+  // Resizing to the current batch size is a no-op that stays invocable.
+  ASSERT_EQ(interpreter.ResizeInputsBatchDimension(4), kTfLiteOk);
+  ASSERT_EQ(interpreter.Invoke(), kTfLiteOk);
+}
+
 TEST(BasicInterpreter, TestNullErrorReporter) {
   TestErrorReporter reporter;
   Interpreter interpreter;
@@ -332,6 +332,13 @@ class OptimizationOptions(options_lib.OptionsBase):
       "Whether to fuse map and filter transformations. If None, defaults to "
       "False.")
 
+  map_filter_batch_fusion = options_lib.create_option(
+      name="map_filter_batch_fusion",
+      ty=bool,
+      docstring=
+      "Whether to fuse map, filter and batch transformations. If None, "
+      "defaults to False.")
+
   map_fusion = options_lib.create_option(
       name="map_fusion",
       ty=bool,
@@ -371,6 +378,8 @@ class OptimizationOptions(options_lib.OptionsBase):
       pb.filter_fusion = self.filter_fusion
     if self.map_and_batch_fusion is not None:
       pb.map_and_batch_fusion = self.map_and_batch_fusion
+    if self.map_filter_batch_fusion is not None:
+      pb.map_filter_batch_fusion = self.map_filter_batch_fusion
     if self.map_and_filter_fusion is not None:
       pb.map_and_filter_fusion = self.map_and_filter_fusion
     if self.map_fusion is not None:
@@ -392,6 +401,8 @@ class OptimizationOptions(options_lib.OptionsBase):
       self.filter_fusion = pb.filter_fusion
     if pb.WhichOneof("optional_map_and_batch_fusion") is not None:
       self.map_and_batch_fusion = pb.map_and_batch_fusion
+    if pb.WhichOneof("optional_map_filter_batch_fusion") is not None:
+      self.map_filter_batch_fusion = pb.map_filter_batch_fusion
     if pb.WhichOneof("optional_map_and_filter_fusion") is not None:
       self.map_and_filter_fusion = pb.map_and_filter_fusion
     if pb.WhichOneof("optional_map_fusion") is not None:
@@ -484,6 +484,51 @@ GpuDriver::ContextGetSharedMemConfig(GpuContext* context) {
   return port::Status::OK();
 }
 
+/* static */ port::Status GpuDriver::StreamBeginCapture(
+    GpuStreamHandle stream) {
+  RETURN_IF_CUDA_RES_ERROR(
+      cuStreamBeginCapture(stream, CU_STREAM_CAPTURE_MODE_THREAD_LOCAL),
+      "Failed to begin stream capture");
+  return port::Status::OK();
+}
+
+/* static */ port::Status GpuDriver::StreamEndCapture(GpuStreamHandle stream,
+                                                      GpuGraphHandle* graph) {
+  RETURN_IF_CUDA_RES_ERROR(cuStreamEndCapture(stream, graph),
+                           "Failed to end stream capture");
+  return port::Status::OK();
+}
+
+/* static */ port::Status GpuDriver::GraphInstantiate(
+    GpuGraphExecHandle* exec, GpuGraphHandle graph) {
+  RETURN_IF_CUDA_RES_ERROR(
+      cuGraphInstantiate(exec, graph, /*phErrorNode=*/nullptr,
+                         /*logBuffer=*/nullptr, /*bufferSize=*/0),
+      "Failed to instantiate CUDA graph");
+  return port::Status::OK();
+}
+
+/* static */ port::Status GpuDriver::GraphLaunch(GpuGraphExecHandle exec,
+                                                 GpuStreamHandle stream) {
+  RETURN_IF_CUDA_RES_ERROR(cuGraphLaunch(exec, stream),
+                           "Failed to launch CUDA graph");
+  return port::Status::OK();
+}
+
+/* static */ void GpuDriver::GraphExecDestroy(GpuGraphExecHandle exec) {
+  CUresult res = cuGraphExecDestroy(exec);
+  if (res != CUDA_SUCCESS) {
+    LOG(ERROR) << "failed to destroy CUDA graph exec: " << ToString(res);
+  }
+}
+
+/* static */ void GpuDriver::GraphDestroy(GpuGraphHandle graph) {
+  CUresult res = cuGraphDestroy(graph);
+  if (res != CUDA_SUCCESS) {
+    LOG(ERROR) << "failed to destroy CUDA graph: " << ToString(res);
+  }
+}
+
 /* static */ port::Status GpuDriver::LoadCubin(GpuContext* context,
                                                const char* cubin_bytes,
                                                CUmodule* module) {
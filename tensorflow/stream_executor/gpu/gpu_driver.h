@@ -269,6 +269,22 @@ class GpuDriver {
       unsigned int block_dim_z, unsigned int shared_mem_bytes,
       GpuStreamHandle stream, void** kernel_params, void** extra);
 
+  // Stream-capture and graph-replay wrappers. Capturing a stream records the
+  // launch sequence issued to it into a graph that can be instantiated once
+  // and then replayed with a single launch per step, eliminating per-kernel
+  // launch overhead for stable-shape work.
+  // http://docs.nvidia.com/cuda/cuda-driver-api/group__CUDA__GRAPH.html
+  // (supported on CUDA only)
+  static port::Status StreamBeginCapture(GpuStreamHandle stream);
+  static port::Status StreamEndCapture(GpuStreamHandle stream,
+                                       GpuGraphHandle* graph);
+  static port::Status GraphInstantiate(GpuGraphExecHandle* exec,
+                                       GpuGraphHandle graph);
+  static port::Status GraphLaunch(GpuGraphExecHandle exec,
+                                  GpuStreamHandle stream);
+  static void GraphExecDestroy(GpuGraphExecHandle exec);
+  static void GraphDestroy(GpuGraphHandle graph);
+
   // Loads ptx_contents with the CUDA driver's PTX JIT and stores the resulting
   // handle in "module". Any error logs that are produced are logged internally.
   // (supported on CUDA only)
@@ -60,6 +60,8 @@ using GpuSharedMemConfig = hipSharedMemConfig;
 using GpuComplexType = hipComplex;
 using GpuDoubleComplexType = hipDoubleComplex;
 using GpuRngHandle = hiprandGenerator_t;
+using GpuGraphHandle = hipGraph_t;
+using GpuGraphExecHandle = hipGraphExec_t;
 
 #else  // CUDA
 
@@ -78,6 +80,8 @@ using GpuFuncCachePreference = CUfunc_cache;
 using GpuSharedMemConfig = CUsharedconfig;
 using GpuComplexType = cuComplex;
 using GpuDoubleComplexType = cuDoubleComplex;
+using GpuGraphHandle = CUgraph;
+using GpuGraphExecHandle = CUgraphExec;
 using GpuRngHandle = curandGenerator_t;
 
 #endif